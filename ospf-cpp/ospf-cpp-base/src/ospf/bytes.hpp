@@ -6,3 +6,4 @@
 #include <ospf/bytes/compaction.hpp>
 #include <ospf/bytes/encoding.hpp>
 #include <ospf/bytes/encryption.hpp>
+#include <ospf/bytes/mapped_file.hpp>
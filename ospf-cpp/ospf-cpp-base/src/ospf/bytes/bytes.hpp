@@ -7,6 +7,9 @@
 #include <ospf/random.hpp>
 #include <ospf/system_info.hpp>
 #include <ospf/type_family.hpp>
+#include <cstring>
+#include <iterator>
+#include <memory>
 #include <span>
 
 namespace ospf
@@ -28,7 +31,7 @@ namespace ospf
         inline Bytes<sizeof(T)> to_bytes(ArgCLRefType<T> value, const Endian endian = local_endian) noexcept
         {
             Bytes<sizeof(T)> bytes{ 0_ub };
-            const auto ptr = reinterpret_cast<ubyte*>(&value);
+            const auto ptr = reinterpret_cast<const ubyte*>(&value);
             if (endian == local_endian)
             {
                 std::copy(ptr, ptr + sizeof(T), bytes.begin());
@@ -46,13 +49,13 @@ namespace ospf
         {
             if (endian == local_endian)
             {
-                const auto ptr = reinterpret_cast<ubyte*>(&value);
-                std::copy(ptr, ptr + sizeof(T), it);
+                const auto ptr = reinterpret_cast<const ubyte*>(&value);
+                it = std::copy(ptr, ptr + sizeof(T), it);
             }
             else
             {
                 const auto bytes = sizeof(T);
-                const auto ptr = reinterpret_cast<ubyte*>(&value) + bytes - 1_iz;
+                auto ptr = reinterpret_cast<const ubyte*>(&value) + bytes - 1_iz;
                 for (usize i{ 0_uz }; i != bytes; ++i)
                 {
                     *it = *ptr;
@@ -110,7 +113,7 @@ namespace ospf
             const auto bytes = sizeof(T);
             if (endian == local_endian)
             {
-                const auto ptr = reinterpret_cast<ubyte*>(&value);
+                auto ptr = reinterpret_cast<ubyte*>(&value);
                 for (usize i{ 0_uz }; i != bytes; ++i)
                 {
                     *ptr = *it;
@@ -120,7 +123,7 @@ namespace ospf
             }
             else
             {
-                const auto ptr = reinterpret_cast<ubyte*>(&value) + bytes - 1_iz;
+                auto ptr = reinterpret_cast<ubyte*>(&value) + bytes - 1_iz;
                 for (usize i{ 0_uz }; i != bytes; ++i)
                 {
                     *ptr = *it;
@@ -130,6 +133,97 @@ namespace ospf
             }
         }
 
+        // block versions of to_bytes / from_bytes for arrays of arithmetic values, the bytes are the same as element by element,
+        // they are one copy if the given endian is the local one, or one byte swapping pass otherwise
+        template<typename T, typename It>
+            requires std::is_arithmetic_v<T> && std::output_iterator<It, ubyte>
+        inline void to_bytes_block(const std::span<const T> values, It& it, const Endian endian = local_endian) noexcept
+        {
+            constexpr const usize bytes = sizeof(T);
+            const auto src = reinterpret_cast<const ubyte*>(values.data());
+            const auto size = values.size_bytes();
+            if constexpr (std::contiguous_iterator<It>)
+            {
+                const auto dst = std::to_address(it);
+                if (bytes == 1_uz || endian == local_endian)
+                {
+                    std::memcpy(dst, src, size);
+                }
+                else
+                {
+                    for (usize i{ 0_uz }; i < size; i += bytes)
+                    {
+                        for (usize j{ 0_uz }; j != bytes; ++j)
+                        {
+                            dst[i + j] = src[i + bytes - 1_uz - j];
+                        }
+                    }
+                }
+                it += static_cast<std::iter_difference_t<It>>(size);
+            }
+            else
+            {
+                if (bytes == 1_uz || endian == local_endian)
+                {
+                    it = std::copy(src, src + size, it);
+                }
+                else
+                {
+                    for (usize i{ 0_uz }; i < size; i += bytes)
+                    {
+                        for (usize j{ 0_uz }; j != bytes; ++j)
+                        {
+                            *it = src[i + bytes - 1_uz - j];
+                            ++it;
+                        }
+                    }
+                }
+            }
+        }
+
+        template<typename T, typename It>
+            requires std::is_arithmetic_v<T> && std::input_iterator<It>
+                && requires (const It& it)
+                {
+                    { *it } -> DecaySameAs<ubyte>;
+                }
+        inline void from_bytes_block(It& it, const std::span<T> values, const Endian endian = local_endian) noexcept
+        {
+            constexpr const usize bytes = sizeof(T);
+            const auto dst = reinterpret_cast<ubyte*>(values.data());
+            const auto size = values.size_bytes();
+            if constexpr (std::contiguous_iterator<It>)
+            {
+                const auto src = reinterpret_cast<const ubyte*>(std::to_address(it));
+                if (bytes == 1_uz || endian == local_endian)
+                {
+                    std::memcpy(dst, src, size);
+                }
+                else
+                {
+                    for (usize i{ 0_uz }; i < size; i += bytes)
+                    {
+                        for (usize j{ 0_uz }; j != bytes; ++j)
+                        {
+                            dst[i + j] = src[i + bytes - 1_uz - j];
+                        }
+                    }
+                }
+                it += static_cast<std::iter_difference_t<It>>(size);
+            }
+            else
+            {
+                for (usize i{ 0_uz }; i < size; i += bytes)
+                {
+                    for (usize j{ 0_uz }; j != bytes; ++j)
+                    {
+                        dst[(bytes == 1_uz || endian == local_endian) ? (i + j) : (i + bytes - 1_uz - j)] = *it;
+                        ++it;
+                    }
+                }
+            }
+        }
+
         template<usize len>
             requires (len != npos)
         inline Bytes<len> random_block(void) noexcept
@@ -3,8 +3,18 @@
 #include <ospf/functional/result.hpp>
 #include <ospf/bytes/auto_link.hpp>
 #include <ospf/bytes/bytes.hpp>
+#include <ospf/memory/pointer.hpp>
+#include <cryptopp/files.h>
 #include <cryptopp/zdeflate.h>
 #include <cryptopp/gzip.h>
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <ostream>
+
+#ifdef OSPF_MULTI_THREAD
+#include <ospf/parallelism/thread_pool.hpp>
+#endif
 
 namespace ospf
 {
@@ -80,7 +90,8 @@ namespace ospf
             }
             case Compaction::GZIP:
             {
-                Gunzip decompacter{};
+                // repeat so that every member of a multi-member stream is read, see Compacter
+                Gunzip decompacter{ nullptr, true };
                 decompacter.PutMessageEnd(reinterpret_cast<const CryptoPP::byte*>(bytes.data()), bytes.size(), -1, true);
                 if (!decompacter.AnyRetrievable())
                 {
@@ -97,5 +108,287 @@ namespace ospf
             }
             return OSPFError{ OSPFErrCode::ApplicationError, "unsupported encoding" };
         }
+
+        // streaming compacter, bytes put into it are compressed block by block and written to the stream,
+        // so that neither the whole input nor the whole output is held in memory, it holds one raw block at a time,
+        // with GZIP and OSPF_MULTI_THREAD, blocks are compressed concurrently into the members of a multi-member gzip stream,
+        // which is read as one stream by standard tools (gzip -d, zcat) and decompact,
+        // then it holds up to one raw block per worker of the thread pool together with their compressed members
+        class Compacter
+        {
+        public:
+            static constexpr const usize default_block_size = 1_uz << 20_uz;
+
+            // output iterator putting bytes into the compacter, e.g. for bytes::Serializer
+            class Iterator
+            {
+            public:
+                struct Writer
+                {
+                    inline const Writer& operator=(const ubyte byte) const noexcept
+                    {
+                        compacter->put(byte);
+                        return *this;
+                    }
+
+                    Compacter* compacter;
+                };
+
+            public:
+                using iterator_category = std::output_iterator_tag;
+                using value_type = void;
+                using difference_type = std::ptrdiff_t;
+                using pointer = void;
+                using reference = void;
+
+            public:
+                Iterator(void) noexcept
+                    : _compacter(nullptr) {}
+                Iterator(Compacter& compacter) noexcept
+                    : _compacter(&compacter) {}
+                Iterator(const Iterator& ano) noexcept = default;
+                Iterator(Iterator&& ano) noexcept = default;
+                Iterator& operator=(const Iterator& rhs) noexcept = default;
+                Iterator& operator=(Iterator&& rhs) noexcept = default;
+                ~Iterator(void) noexcept = default;
+
+            public:
+                inline Writer operator*(void) const noexcept
+                {
+                    return Writer{ _compacter };
+                }
+
+                inline Iterator& operator++(void) noexcept
+                {
+                    return *this;
+                }
+
+                inline Iterator operator++(int) noexcept
+                {
+                    return *this;
+                }
+
+            private:
+                Compacter* _compacter;
+            };
+
+        public:
+            Compacter(std::ostream& os, const Compaction compaction, const usize block_size = default_block_size)
+                : _os(&os), _compaction(compaction), _block_size((std::max)(block_size, 1_uz)), _written(false), _finished(false)
+            {
+                _block.reserve(_block_size);
+                if (!parallel())
+                {
+                    try
+                    {
+                        switch (_compaction)
+                        {
+                        case Compaction::Deflate:
+                            _filter = Unique<CryptoPP::BufferedTransformation>{ new CryptoPP::Deflator{ new CryptoPP::FileSink{ *_os } } };
+                            break;
+                        case Compaction::GZIP:
+                            _filter = Unique<CryptoPP::BufferedTransformation>{ new CryptoPP::Gzip{ new CryptoPP::FileSink{ *_os } } };
+                            break;
+                        default:
+                            _err = OSPFError{ OSPFErrCode::ApplicationError, "unsupported encoding" };
+                            break;
+                        }
+                    }
+                    catch (const CryptoPP::Exception& e)
+                    {
+                        _err = OSPFError{ OSPFErrCode::ApplicationError, e.what() };
+                    }
+                }
+            }
+
+            Compacter(const Compacter& ano) = delete;
+            Compacter(Compacter&& ano) = delete;
+            Compacter& operator=(const Compacter& rhs) = delete;
+            Compacter& operator=(Compacter&& rhs) = delete;
+
+            ~Compacter(void) noexcept
+            {
+                finish();
+            }
+
+        public:
+            inline Iterator iterator(void) noexcept
+            {
+                return Iterator{ *this };
+            }
+
+            inline void put(const ubyte byte) noexcept
+            {
+                _block.push_back(byte);
+                if (_block.size() == _block_size)
+                {
+                    flush_block();
+                }
+            }
+
+            template<usize len>
+            inline void put(const BytesView<len> bytes) noexcept
+            {
+                usize i{ 0_uz };
+                while (i != bytes.size())
+                {
+                    const auto amount = (std::min)(_block_size - _block.size(), bytes.size() - i);
+                    _block.insert(_block.end(), bytes.begin() + i, bytes.begin() + i + amount);
+                    i += amount;
+                    if (_block.size() == _block_size)
+                    {
+                        flush_block();
+                    }
+                }
+            }
+
+            // compress what is left and end the stream, the first failure of the whole stream is returned
+            inline Try<> finish(void) noexcept
+            {
+                if (!_finished)
+                {
+                    _finished = true;
+                    if (parallel())
+                    {
+#ifdef OSPF_MULTI_THREAD
+                        // an empty input still makes one member, an empty file is not a valid gzip stream
+                        if (!_block.empty() || (!_written && _pending.empty()))
+                        {
+                            _pending.push_back(std::move(_block));
+                            _block = Bytes<>{};
+                        }
+                        flush_pending();
+#endif
+                    }
+                    else if (!_err.has_value())
+                    {
+                        try
+                        {
+                            _filter->Put(reinterpret_cast<const CryptoPP::byte*>(_block.data()), _block.size());
+                            _filter->MessageEnd();
+                            _block.clear();
+                        }
+                        catch (const CryptoPP::Exception& e)
+                        {
+                            _err = OSPFError{ OSPFErrCode::ApplicationError, e.what() };
+                        }
+                    }
+                    _os->flush();
+                    if (!_err.has_value() && _os->fail())
+                    {
+                        _err = OSPFError{ OSPFErrCode::SerializationFail, "failed writing the compacted stream" };
+                    }
+                }
+
+                if (_err.has_value())
+                {
+                    return *_err;
+                }
+                else
+                {
+                    return succeed;
+                }
+            }
+
+        private:
+            inline const bool parallel(void) const noexcept
+            {
+#ifdef OSPF_MULTI_THREAD
+                return _compaction == Compaction::GZIP;
+#else
+                return false;
+#endif
+            }
+
+            inline void flush_block(void) noexcept
+            {
+                if (_err.has_value())
+                {
+                    _block.clear();
+                    return;
+                }
+
+                if (parallel())
+                {
+#ifdef OSPF_MULTI_THREAD
+                    _pending.push_back(std::move(_block));
+                    _block = Bytes<>{};
+                    _block.reserve(_block_size);
+                    if (_pending.size() >= ThreadPool::instance().worker_amount())
+                    {
+                        flush_pending();
+                    }
+#endif
+                }
+                else
+                {
+                    try
+                    {
+                        _filter->Put(reinterpret_cast<const CryptoPP::byte*>(_block.data()), _block.size());
+                    }
+                    catch (const CryptoPP::Exception& e)
+                    {
+                        _err = OSPFError{ OSPFErrCode::ApplicationError, e.what() };
+                    }
+                    _block.clear();
+                }
+            }
+
+#ifdef OSPF_MULTI_THREAD
+            // every pending block becomes a complete gzip member, they are written in order
+            inline void flush_pending(void) noexcept
+            {
+                if (_err.has_value() || _pending.empty())
+                {
+                    _pending.clear();
+                    return;
+                }
+
+                std::vector<Bytes<>> members(_pending.size());
+                auto ret = ThreadPool::instance().parallel_for(0_uz, _pending.size(), [this, &members](const usize i) -> Try<>
+                    {
+                        try
+                        {
+                            OSPF_TRY_GET(member, compact(BytesView<>{ _pending[i] }, Compaction::GZIP));
+                            members[i] = std::move(member);
+                            return succeed;
+                        }
+                        catch (const CryptoPP::Exception& e)
+                        {
+                            return OSPFError{ OSPFErrCode::ApplicationError, e.what() };
+                        }
+                    }, 1_uz);
+                _pending.clear();
+                if (ret.is_failed())
+                {
+                    _err = std::move(ret).err();
+                    return;
+                }
+                for (const auto& member : members)
+                {
+                    _os->write(reinterpret_cast<const char*>(member.data()), static_cast<std::streamsize>(member.size()));
+                    if (_os->fail())
+                    {
+                        _err = OSPFError{ OSPFErrCode::SerializationFail, "failed writing the compacted stream" };
+                        return;
+                    }
+                }
+                _written = true;
+            }
+#endif
+
+        private:
+            std::ostream* _os;
+            Compaction _compaction;
+            usize _block_size;
+            Bytes<> _block;
+#ifdef OSPF_MULTI_THREAD
+            std::vector<Bytes<>> _pending;
+#endif
+            Unique<CryptoPP::BufferedTransformation> _filter;
+            std::optional<OSPFError> _err;
+            bool _written;
+            bool _finished;
+        };
     };
 };
@@ -0,0 +1,128 @@
+﻿#include <ospf/bytes/mapped_file.hpp>
+#include <format>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ospf::bytes
+{
+#ifdef _WIN32
+    Result<MappedFile> MappedFile::open(const std::filesystem::path& path) noexcept
+    {
+        if (!std::filesystem::exists(path))
+        {
+            return OSPFError{ OSPFErrCode::FileNotFound, std::format("\"{}\" not exist", path.string()) };
+        }
+        if (std::filesystem::is_directory(path))
+        {
+            return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" is not a file", path.string()) };
+        }
+
+        const auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return OSPFError{ OSPFErrCode::FileNotFound, std::format("\"{}\" cannot be opened", path.string()) };
+        }
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            return OSPFError{ OSPFErrCode::NotAFile, std::format("size of \"{}\" unknown", path.string()) };
+        }
+        if (size.QuadPart == 0)
+        {
+            // an empty file cannot be mapped
+            CloseHandle(file);
+            return MappedFile{};
+        }
+
+        const auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" cannot be mapped", path.string()) };
+        }
+
+        // the view keeps the mapping object alive after its handle is closed
+        const auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (data == nullptr)
+        {
+            return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" cannot be mapped", path.string()) };
+        }
+        return MappedFile{ static_cast<const ubyte*>(data), static_cast<usize>(size.QuadPart) };
+    }
+
+    void MappedFile::release(void) noexcept
+    {
+        if (_data != nullptr)
+        {
+            UnmapViewOfFile(_data);
+            _data = nullptr;
+            _size = 0_uz;
+        }
+    }
+#else
+    Result<MappedFile> MappedFile::open(const std::filesystem::path& path) noexcept
+    {
+        if (!std::filesystem::exists(path))
+        {
+            return OSPFError{ OSPFErrCode::FileNotFound, std::format("\"{}\" not exist", path.string()) };
+        }
+        if (std::filesystem::is_directory(path))
+        {
+            return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" is not a file", path.string()) };
+        }
+
+        const auto fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return OSPFError{ OSPFErrCode::FileNotFound, std::format("\"{}\" cannot be opened", path.string()) };
+        }
+
+        struct stat status{};
+        if (::fstat(fd, &status) == -1)
+        {
+            ::close(fd);
+            return OSPFError{ OSPFErrCode::NotAFile, std::format("size of \"{}\" unknown", path.string()) };
+        }
+        if (status.st_size == 0)
+        {
+            // an empty file cannot be mapped
+            ::close(fd);
+            return MappedFile{};
+        }
+
+        // the mapping stays valid after the descriptor is closed
+        const auto size = static_cast<usize>(status.st_size);
+        const auto data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED)
+        {
+            return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" cannot be mapped", path.string()) };
+        }
+        ::madvise(data, size, MADV_SEQUENTIAL);
+        return MappedFile{ static_cast<const ubyte*>(data), size };
+    }
+
+    void MappedFile::release(void) noexcept
+    {
+        if (_data != nullptr)
+        {
+            ::munmap(const_cast<ubyte*>(_data), _size);
+            _data = nullptr;
+            _size = 0_uz;
+        }
+    }
+#endif
+};
@@ -0,0 +1,89 @@
+﻿#pragma once
+
+#include <ospf/basic_definition.hpp>
+#include <ospf/bytes/bytes.hpp>
+#include <ospf/concepts/base.hpp>
+#include <ospf/functional/result.hpp>
+#include <ospf/literal_constant.hpp>
+#include <filesystem>
+#include <string_view>
+#include <utility>
+
+namespace ospf
+{
+    inline namespace bytes
+    {
+        // read-only mapping of a whole file into memory, the mapping is released with the object
+        class MappedFile
+        {
+        public:
+            OSPF_BASE_API static Result<MappedFile> open(const std::filesystem::path& path) noexcept;
+
+        private:
+            MappedFile(const ubyte* data, const usize size) noexcept
+                : _data(data), _size(size) {}
+
+        public:
+            MappedFile(void) noexcept
+                : _data(nullptr), _size(0_uz) {}
+            MappedFile(const MappedFile& ano) = delete;
+            MappedFile(MappedFile&& ano) noexcept
+                : _data(std::exchange(ano._data, nullptr)), _size(std::exchange(ano._size, 0_uz)) {}
+            MappedFile& operator=(const MappedFile& rhs) = delete;
+            MappedFile& operator=(MappedFile&& rhs) noexcept
+            {
+                if (this != &rhs)
+                {
+                    release();
+                    _data = std::exchange(rhs._data, nullptr);
+                    _size = std::exchange(rhs._size, 0_uz);
+                }
+                return *this;
+            }
+
+            ~MappedFile(void) noexcept
+            {
+                release();
+            }
+
+        public:
+            inline const ubyte* data(void) const noexcept
+            {
+                return _data;
+            }
+
+            inline const usize size(void) const noexcept
+            {
+                return _size;
+            }
+
+            inline const bool empty(void) const noexcept
+            {
+                return _size == 0_uz;
+            }
+
+            inline BytesView<> view(void) const noexcept
+            {
+                return BytesView<>{ _data, _size };
+            }
+
+            // the content reinterpreted as characters, a trailing incomplete character is dropped
+            template<CharType CharT = char>
+            inline std::basic_string_view<CharT> text(void) const noexcept
+            {
+                if (_data == nullptr)
+                {
+                    return std::basic_string_view<CharT>{};
+                }
+                return std::basic_string_view<CharT>{ reinterpret_cast<const CharT*>(_data), _size / sizeof(CharT) };
+            }
+
+        private:
+            OSPF_BASE_API void release(void) noexcept;
+
+        private:
+            const ubyte* _data;
+            usize _size;
+        };
+    };
+};
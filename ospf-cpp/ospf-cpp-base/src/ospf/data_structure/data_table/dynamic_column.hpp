@@ -2,6 +2,8 @@
 
 #include <ospf/data_structure/data_table/impl.hpp>
 #include <ospf/data_structure/data_table/cell.hpp>
+#include <ospf/data_structure/data_table/flat_table.hpp>
+#include <ospf/data_structure/data_table/reduction.hpp>
 #include <ospf/data_structure/reference_array.hpp>
 #include <ospf/string/hasher.hpp>
 
@@ -66,7 +68,7 @@ namespace ospf
                     std::vector<DataTableHeader<CharT>>, 
                     std::span<const OriginType<C>>, 
                     DynRefArray<OriginType<C>>, 
-                    std::vector<std::vector<OriginType<C>>>, 
+                    FlatTable<OriginType<C>>, 
                     DataTable<C, dynamic_column, StoreType::Row, CharT>
                 >
             {
@@ -78,7 +80,7 @@ namespace ospf
                     std::vector<DataTableHeader<CharT>>,
                     std::span<const OriginType<C>>,
                     DynRefArray<OriginType<C>>,
-                    std::vector<std::vector<OriginType<C>>>,
+                    FlatTable<OriginType<C>>,
                     DataTable<C, dynamic_column, StoreType::Row, CharT>
                 >;
 
@@ -110,7 +112,7 @@ namespace ospf
                 DataTable(void) = default;
 
                 DataTable(HeaderType header)
-                    : _header(std::move(header)) 
+                    : _header(std::move(header)), _table(_header.size())
                 {
                     for (usize i{ 0_uz }; i != _header.size(); ++i)
                     {
@@ -172,10 +174,10 @@ namespace ospf
                     }
                     _header.insert(_header.cbegin() + pos, move<DataTableHeader<CharT>>(header));
                     _header_index.insert({ _header[pos].name(), pos });
-                    for (auto& row : _table)
-                    {
-                        row.insert(row.cbegin() + pos, value);
-                    }
+                    _table.insert_column(pos, [&value](const usize _)
+                        {
+                            return value;
+                        });
                     return pos + 1_uz;
                 }
 
@@ -220,15 +222,14 @@ namespace ospf
                     }
                     _header.insert(_header.cbegin() + pos, move<DataTableHeader<CharT>>(header));
                     _header_index.insert({ _header[pos].name(), pos });
-                    for (usize i{ 0_uz }; i != this->row(); ++i)
-                    {
-                        auto& row = _table[i];
 #ifdef _DEBUG
-                        row.insert(row.cbegin() + pos, std::move(new_column[i]));
+                    _table.insert_column(pos, [&new_column](const usize i)
+                        {
+                            return std::move(new_column[i]);
+                        });
 #else
-                        row.insert(row.cbegin() + pos, constructor(i));
+                    _table.insert_column(pos, constructor);
 #endif
-                    }
                     return pos + 1_uz;
                 }
 
@@ -259,6 +260,34 @@ namespace ospf
                     return pos + 1_iz;
                 }
 
+            public:
+                // the cells are stored row by row in one buffer, reserve it for the coming rows at once
+                inline void reserve(const usize row)
+                {
+                    _table.reserve(row);
+                }
+
+                // append amount rows at the end, constructor(i, j) gives the cell of column j in the i-th new row
+                template<typename F>
+                    requires requires (const F& fun, const usize i, const usize j)
+                    {
+                        { fun(i, j) } -> DecaySameAs<CellType>;
+                    }
+                inline const usize append_rows(const usize amount, const F& constructor)
+                {
+#ifdef _DEBUG
+                    _table.append_rows(amount, [this, &constructor](const usize i, const usize j)
+                        {
+                            auto value = constructor(i, j);
+                            check_type(j, value);
+                            return value;
+                        });
+#else
+                    _table.append_rows(amount, constructor);
+#endif
+                    return this->row();
+                }
+
             OSPF_CRTP_PERMISSION:
                 inline LRefType<HeaderType> OSPF_CRTP_FUNCTION(get_header)(void) noexcept
                 {
@@ -268,9 +297,9 @@ namespace ospf
                 inline void OSPF_CRTP_FUNCTION(set_header)(const usize i, ArgRRefType<DataTableHeader<CharT>> header)
                 {
 #ifdef _DEBUG
-                    for (const auto& row : _table)
+                    for (usize r{ 0_uz }; r != _table.size(); ++r)
                     {
-                        const auto type = CellValueTypeTrait<CellType>::type(row[i]);
+                        const auto type = CellValueTypeTrait<CellType>::type(_table[r][i]);
                         if (type.has_value())
                         {
                             if (header.empty())
@@ -329,9 +358,9 @@ namespace ospf
                 inline RetType<ColumnViewType> OSPF_CRTP_FUNCTION(get_column)(const usize i) const
                 {
                     ColumnViewType ret;
-                    for (const auto& row : _table)
+                    for (usize r{ 0_uz }; r != _table.size(); ++r)
                     {
-                        ret.push_back(row[i]);
+                        ret.push_back(_table[r][i]);
                     }
                     return ret;
                 }
@@ -356,45 +385,34 @@ namespace ospf
                     }
 #endif
 
-                    _table.insert(_table.cbegin() + pos, std::vector<CellType>{ this->column(), value });
+                    _table.insert_row(pos, value);
                 }
 
                 inline void OSPF_CRTP_FUNCTION(insert_row_by_constructor)(const usize pos, const RowConstructor& constructor)
                 {
-                    std::vector<CellType> new_row;
-                    new_row.reserve(this->column());
-                    for (usize i{ 0_uz }; i != this->column(); ++i)
-                    {
-#ifdef _DEBUG
-                        auto value = constructor(i, _header[i]);
-                        const auto type = CellValueTypeTrait<CellType>::type(value);
-                        if (type.has_value())
+                    _table.insert_row(pos, [this, &constructor](const usize i)
                         {
-                            if (_header[i].empty())
-                            {
-                                throw OSPFException{ OSPFErrCode::ApplicationError, std::format("header of column {} is uninitialized", i) };
-                            }
-                            else if (!_header[i].matched(*type))
-                            {
-                                throw OSPFException{ OSPFErrCode::ApplicationError, std::format("type {} is not matched header of column {}: {}", type_name(*type), i, _header[i]) };
-                            }
-                        }
-                        new_row.push_back(std::move(value));
+#ifdef _DEBUG
+                            auto value = constructor(i, _header[i]);
+                            check_type(i, value);
+                            return value;
 #else
-                        new_row.push_back(constructor(i, _header[i]));
+                            return constructor(i, _header[i]);
 #endif
-                    }
-                    _table.insert(_table.cbegin() + pos, std::move(new_row));
+                        });
                 }
 
                 inline void OSPF_CRTP_FUNCTION(erase_row)(const usize pos)
                 {
-                    _table.erase(_table.begin() + pos);
+                    _table.erase_row(pos);
                 }
 
                 inline void OSPF_CRTP_FUNCTION(clear_header)(void)
                 {
+                    // every row is shaped by the header, so the cells go with it
                     _header.clear();
+                    _header_index.clear();
+                    _table = TableType{};
                 }
 
                 inline void OSPF_CRTP_FUNCTION(clear_table)(void)
@@ -402,10 +420,29 @@ namespace ospf
                     _table.clear();
                 }
 
+#ifdef _DEBUG
+            private:
+                inline void check_type(const usize i, ArgCLRefType<CellType> value) const
+                {
+                    const auto type = CellValueTypeTrait<CellType>::type(value);
+                    if (type.has_value())
+                    {
+                        if (_header[i].empty())
+                        {
+                            throw OSPFException{ OSPFErrCode::ApplicationError, std::format("header of column {} is uninitialized", i) };
+                        }
+                        else if (!_header[i].matched(*type))
+                        {
+                            throw OSPFException{ OSPFErrCode::ApplicationError, std::format("type {} is not matched header of column {}: {}", type_name(*type), i, _header[i]) };
+                        }
+                    }
+                }
+#endif
+
             private:
                 HeaderType _header;
                 StringHashMap<StringViewType, usize> _header_index;
-                std::vector<std::vector<CellType>> _table;
+                FlatTable<CellType> _table;
             };
 
             template<typename C, CharType CharT>
@@ -462,7 +499,7 @@ namespace ospf
                 DataTable(void) = default;
 
                 DataTable(HeaderType header)
-                    : _header(std::move(header)) 
+                    : _header(std::move(header)), _table(_header.size())
                 {
                     for (usize i{ 0_uz }; i != _header.size(); ++i)
                     {
@@ -495,7 +532,7 @@ namespace ospf
                     requires WithDefault<CellType>
                 inline const usize insert_column(const usize pos, ArgRRefType<DataTableHeader<CharT>> header)
                 {
-                    return insert_row(pos, move<DataTableHeader<CharT>>(header), DefaultValue<CellType>::value());
+                    return insert_column(pos, move<DataTableHeader<CharT>>(header), DefaultValue<CellType>::value());
                 }
 
                 inline const usize insert_column(const usize pos, ArgRRefType<DataTableHeader<CharT>> header, ArgCLRefType<CellType> value)
@@ -524,7 +561,7 @@ namespace ospf
                     }
                     _header.insert(_header.cbegin() + pos, move<DataTableHeader<CharT>>(header));
                     _header_index.insert({ _header[pos].name(), pos });
-                    _table.insert(_table.cbegin() + pos, std::vector<CellType>{ this->row(), value });
+                    _table.insert(_table.cbegin() + pos, std::vector<CellType>(this->row(), value));
                     return pos + 1_uz;
                 }
 
@@ -602,6 +639,49 @@ namespace ospf
                     return pos + 1_iz;
                 }
 
+            public:
+                // reductions straight over the contiguous storage of column i, see data_table/reduction.hpp
+                template<typename T = CellType>
+                    requires std::is_arithmetic_v<T>
+                inline T sum(const usize i) const noexcept
+                {
+                    return data_table::sum<T>(std::span<const CellType>{ _table[i] });
+                }
+
+                template<typename T = CellType>
+                    requires std::totally_ordered<T> && std::copyable<T>
+                inline std::optional<T> minimum(const usize i) const noexcept
+                {
+                    return data_table::minimum<T>(std::span<const CellType>{ _table[i] });
+                }
+
+                template<typename T = CellType>
+                    requires std::totally_ordered<T> && std::copyable<T>
+                inline std::optional<T> maximum(const usize i) const noexcept
+                {
+                    return data_table::maximum<T>(std::span<const CellType>{ _table[i] });
+                }
+
+                template<typename T = CellType>
+                inline const usize count(const usize i) const noexcept
+                {
+                    return data_table::count<T>(std::span<const CellType>{ _table[i] });
+                }
+
+                template<typename T = CellType, typename F>
+                    requires std::predicate<F, const T&>
+                inline const usize count(const usize i, const F& pred) const noexcept
+                {
+                    return data_table::count<T>(std::span<const CellType>{ _table[i] }, pred);
+                }
+
+                template<typename T = CellType, typename F>
+                    requires std::predicate<F, const T&>
+                inline std::vector<u8> filter_mask(const usize i, const F& pred) const noexcept
+                {
+                    return data_table::filter_mask<T>(std::span<const CellType>{ _table[i] }, pred);
+                }
+
             OSPF_CRTP_PERMISSION:
                 inline LRefType<HeaderType> OSPF_CRTP_FUNCTION(get_header)(void) noexcept
                 {
@@ -685,7 +765,7 @@ namespace ospf
                     {
                         auto& column = _table[i];
 #ifdef _DEBUG
-                        const auto type = CellValueTypeTrait::type(value);
+                        const auto type = CellValueTypeTrait<CellType>::type(value);
                         if (type.has_value())
                         {
                             if (_header[i].empty())
@@ -738,12 +818,18 @@ namespace ospf
 
                 inline void OSPF_CRTP_FUNCTION(clear_header)(void)
                 {
+                    // every column has its own storage, so they go with the header
                     _header.clear();
+                    _header_index.clear();
+                    _table.clear();
                 }
 
                 inline void OSPF_CRTP_FUNCTION(clear_table)(void)
                 {
-                    _table.clear();
+                    for (auto& column : _table)
+                    {
+                        column.clear();
+                    }
                 }
 
             private:
@@ -0,0 +1,323 @@
+﻿#pragma once
+
+#include <ospf/basic_definition.hpp>
+#include <ospf/literal_constant.hpp>
+#include <ospf/type_family.hpp>
+#include <compare>
+#include <iterator>
+#include <span>
+#include <vector>
+
+namespace ospf
+{
+    inline namespace data_structure
+    {
+        namespace data_table
+        {
+            // cells of a row-major table in one contiguous buffer, row i takes [i * column, (i + 1) * column)
+            template<typename C>
+            class FlatTable
+            {
+            public:
+                using CellType = C;
+                using RowViewType = std::span<const CellType>;
+                using RowMutViewType = std::span<CellType>;
+
+                // iterator over the rows, a row is got as a view, so the table is iterated as std::vector<std::vector<C>> was
+                template<typename Cell>
+                class RowIterator
+                {
+                public:
+                    using iterator_concept = std::random_access_iterator_tag;
+                    using iterator_category = std::input_iterator_tag;
+                    using value_type = std::span<Cell>;
+                    using difference_type = std::ptrdiff_t;
+                    using reference = std::span<Cell>;
+
+                public:
+                    RowIterator(void)
+                        : _cells(nullptr), _column(0_uz), _row(0_uz) {}
+                    RowIterator(Cell* const cells, const usize column, const usize row)
+                        : _cells(cells), _column(column), _row(row) {}
+                    RowIterator(const RowIterator& ano) = default;
+                    RowIterator(RowIterator&& ano) noexcept = default;
+                    RowIterator& operator=(const RowIterator& rhs) = default;
+                    RowIterator& operator=(RowIterator&& rhs) noexcept = default;
+                    ~RowIterator(void) = default;
+
+                public:
+                    inline reference operator*(void) const noexcept
+                    {
+                        return reference{ _cells + _row * _column, _column };
+                    }
+
+                    inline reference operator[](const difference_type n) const noexcept
+                    {
+                        return *(*this + n);
+                    }
+
+                    inline RowIterator& operator++(void) noexcept
+                    {
+                        ++_row;
+                        return *this;
+                    }
+
+                    inline RowIterator operator++(int) noexcept
+                    {
+                        auto ret = *this;
+                        ++_row;
+                        return ret;
+                    }
+
+                    inline RowIterator& operator--(void) noexcept
+                    {
+                        --_row;
+                        return *this;
+                    }
+
+                    inline RowIterator operator--(int) noexcept
+                    {
+                        auto ret = *this;
+                        --_row;
+                        return ret;
+                    }
+
+                    inline RowIterator& operator+=(const difference_type n) noexcept
+                    {
+                        _row = static_cast<usize>(static_cast<difference_type>(_row) + n);
+                        return *this;
+                    }
+
+                    inline RowIterator& operator-=(const difference_type n) noexcept
+                    {
+                        _row = static_cast<usize>(static_cast<difference_type>(_row) - n);
+                        return *this;
+                    }
+
+                    inline RowIterator operator+(const difference_type n) const noexcept
+                    {
+                        auto ret = *this;
+                        ret += n;
+                        return ret;
+                    }
+
+                    inline RowIterator operator-(const difference_type n) const noexcept
+                    {
+                        auto ret = *this;
+                        ret -= n;
+                        return ret;
+                    }
+
+                    inline difference_type operator-(const RowIterator& rhs) const noexcept
+                    {
+                        return static_cast<difference_type>(_row) - static_cast<difference_type>(rhs._row);
+                    }
+
+                    inline friend RowIterator operator+(const difference_type n, const RowIterator& it) noexcept
+                    {
+                        return it + n;
+                    }
+
+                public:
+                    inline const bool operator==(const RowIterator& rhs) const noexcept
+                    {
+                        return _cells == rhs._cells && _row == rhs._row;
+                    }
+
+                    inline std::strong_ordering operator<=>(const RowIterator& rhs) const noexcept
+                    {
+                        return _row <=> rhs._row;
+                    }
+
+                private:
+                    // the row is counted instead of the cell, so that a table without columns still has its rows
+                    Cell* _cells;
+                    usize _column;
+                    usize _row;
+                };
+
+                using IterType = RowIterator<CellType>;
+                using ConstIterType = RowIterator<const CellType>;
+
+            public:
+                FlatTable(void)
+                    : _column(0_uz), _row(0_uz) {}
+                explicit FlatTable(const usize column)
+                    : _column(column), _row(0_uz) {}
+                FlatTable(const FlatTable& ano) = default;
+                FlatTable(FlatTable&& ano) noexcept = default;
+                FlatTable& operator=(const FlatTable& rhs) = default;
+                FlatTable& operator=(FlatTable&& rhs) noexcept = default;
+                ~FlatTable(void) = default;
+
+            public:
+                inline const usize column(void) const noexcept
+                {
+                    return _column;
+                }
+
+                // amount of rows
+                inline const usize size(void) const noexcept
+                {
+                    return _row;
+                }
+
+                inline const bool empty(void) const noexcept
+                {
+                    return _row == 0_uz;
+                }
+
+                inline const CellType* data(void) const noexcept
+                {
+                    return _cells.data();
+                }
+
+                inline RowMutViewType operator[](const usize i) noexcept
+                {
+                    return RowMutViewType{ _cells.data() + i * _column, _column };
+                }
+
+                inline RowViewType operator[](const usize i) const noexcept
+                {
+                    return RowViewType{ _cells.data() + i * _column, _column };
+                }
+
+                inline RowMutViewType front(void) noexcept
+                {
+                    return (*this)[0_uz];
+                }
+
+                inline RowViewType front(void) const noexcept
+                {
+                    return (*this)[0_uz];
+                }
+
+                inline RowMutViewType back(void) noexcept
+                {
+                    return (*this)[_row - 1_uz];
+                }
+
+                inline RowViewType back(void) const noexcept
+                {
+                    return (*this)[_row - 1_uz];
+                }
+
+            public:
+                inline IterType begin(void) noexcept
+                {
+                    return IterType{ _cells.data(), _column, 0_uz };
+                }
+
+                inline ConstIterType begin(void) const noexcept
+                {
+                    return ConstIterType{ _cells.data(), _column, 0_uz };
+                }
+
+                inline ConstIterType cbegin(void) const noexcept
+                {
+                    return begin();
+                }
+
+                inline IterType end(void) noexcept
+                {
+                    return IterType{ _cells.data(), _column, _row };
+                }
+
+                inline ConstIterType end(void) const noexcept
+                {
+                    return ConstIterType{ _cells.data(), _column, _row };
+                }
+
+                inline ConstIterType cend(void) const noexcept
+                {
+                    return end();
+                }
+
+            public:
+                inline void reserve(const usize row)
+                {
+                    _cells.reserve(row * _column);
+                }
+
+                inline void clear(void) noexcept
+                {
+                    _cells.clear();
+                    _row = 0_uz;
+                }
+
+                inline void insert_row(const usize pos, ArgCLRefType<CellType> value)
+                {
+                    _cells.insert(_cells.cbegin() + pos * _column, _column, value);
+                    ++_row;
+                }
+
+                // constructor(j) gives the cell of column j
+                template<typename F>
+                inline void insert_row(const usize pos, const F& constructor)
+                {
+                    if (pos == _row)
+                    {
+                        for (usize j{ 0_uz }; j != _column; ++j)
+                        {
+                            _cells.push_back(constructor(j));
+                        }
+                    }
+                    else
+                    {
+                        std::vector<CellType> new_row;
+                        new_row.reserve(_column);
+                        for (usize j{ 0_uz }; j != _column; ++j)
+                        {
+                            new_row.push_back(constructor(j));
+                        }
+                        _cells.insert(_cells.cbegin() + pos * _column, std::make_move_iterator(new_row.begin()), std::make_move_iterator(new_row.end()));
+                    }
+                    ++_row;
+                }
+
+                // constructor(i, j) gives the cell of column j in the i-th new row
+                template<typename F>
+                inline void append_rows(const usize amount, const F& constructor)
+                {
+                    _cells.reserve(_cells.size() + amount * _column);
+                    for (usize i{ 0_uz }; i != amount; ++i)
+                    {
+                        for (usize j{ 0_uz }; j != _column; ++j)
+                        {
+                            _cells.push_back(constructor(i, j));
+                        }
+                    }
+                    _row += amount;
+                }
+
+                inline void erase_row(const usize pos)
+                {
+                    _cells.erase(_cells.cbegin() + pos * _column, _cells.cbegin() + (pos + 1_uz) * _column);
+                    --_row;
+                }
+
+                // the stride changes, so the buffer is rebuilt, constructor(i) gives the new cell of row i
+                template<typename F>
+                inline void insert_column(const usize pos, const F& constructor)
+                {
+                    std::vector<CellType> cells;
+                    cells.reserve(_row * (_column + 1_uz));
+                    for (usize i{ 0_uz }; i != _row; ++i)
+                    {
+                        const auto bg = _cells.begin() + i * _column;
+                        std::move(bg, bg + pos, std::back_inserter(cells));
+                        cells.push_back(constructor(i));
+                        std::move(bg + pos, bg + _column, std::back_inserter(cells));
+                    }
+                    _cells = std::move(cells);
+                    ++_column;
+                }
+
+            private:
+                usize _column;
+                usize _row;
+                std::vector<CellType> _cells;
+            };
+        };
+    };
+};
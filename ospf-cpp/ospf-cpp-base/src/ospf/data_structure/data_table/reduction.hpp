@@ -0,0 +1,192 @@
+﻿#pragma once
+
+#include <ospf/basic_definition.hpp>
+#include <ospf/literal_constant.hpp>
+#include <optional>
+#include <span>
+#include <variant>
+#include <vector>
+
+namespace ospf
+{
+    inline namespace data_structure
+    {
+        namespace data_table
+        {
+            namespace reduction_detail
+            {
+                template<typename T, typename C>
+                inline const T* value_of(const C& cell) noexcept
+                {
+                    if constexpr (std::is_same_v<C, T>)
+                    {
+                        return &cell;
+                    }
+                    else if constexpr (requires { cell.has_value(); *cell; })
+                    {
+                        return cell.has_value() ? value_of<T>(*cell) : nullptr;
+                    }
+                    else if constexpr (requires { std::get_if<T>(&cell); })
+                    {
+                        return std::get_if<T>(&cell);
+                    }
+                    else
+                    {
+                        static_assert(std::is_same_v<C, T>, "cell type has no value of type T");
+                        return nullptr;
+                    }
+                }
+            };
+
+            // reductions over a column, cells without a value of type T (null or other alternatives) are skipped
+            // if the cells are T themselves, the loops run straight over the contiguous column and can be vectorized
+
+            template<typename T, typename C>
+                requires std::is_arithmetic_v<T>
+            inline T sum(const std::span<const C> column) noexcept
+            {
+                if constexpr (std::is_same_v<C, T>)
+                {
+                    // independent lanes let the compiler keep several partial sums in flight
+                    T lanes[4_uz]{ T{}, T{}, T{}, T{} };
+                    const auto tail = column.size() - column.size() % 4_uz;
+                    for (usize i{ 0_uz }; i != tail; i += 4_uz)
+                    {
+                        lanes[0_uz] += column[i];
+                        lanes[1_uz] += column[i + 1_uz];
+                        lanes[2_uz] += column[i + 2_uz];
+                        lanes[3_uz] += column[i + 3_uz];
+                    }
+                    for (usize i{ tail }; i != column.size(); ++i)
+                    {
+                        lanes[0_uz] += column[i];
+                    }
+                    return (lanes[0_uz] + lanes[1_uz]) + (lanes[2_uz] + lanes[3_uz]);
+                }
+                else
+                {
+                    T ret{};
+                    for (const auto& cell : column)
+                    {
+                        if (const auto value = reduction_detail::value_of<T>(cell))
+                        {
+                            ret += *value;
+                        }
+                    }
+                    return ret;
+                }
+            }
+
+            template<typename T, typename C>
+                requires std::totally_ordered<T> && std::copyable<T>
+            inline std::optional<T> minimum(const std::span<const C> column) noexcept
+            {
+                if constexpr (std::is_same_v<C, T>)
+                {
+                    if (column.empty())
+                    {
+                        return std::nullopt;
+                    }
+                    T ret{ column.front() };
+                    for (usize i{ 1_uz }; i != column.size(); ++i)
+                    {
+                        ret = column[i] < ret ? column[i] : ret;
+                    }
+                    return ret;
+                }
+                else
+                {
+                    const T* ret{ nullptr };
+                    for (const auto& cell : column)
+                    {
+                        const auto value = reduction_detail::value_of<T>(cell);
+                        if (value != nullptr && (ret == nullptr || *value < *ret))
+                        {
+                            ret = value;
+                        }
+                    }
+                    return ret != nullptr ? std::optional<T>{ *ret } : std::nullopt;
+                }
+            }
+
+            template<typename T, typename C>
+                requires std::totally_ordered<T> && std::copyable<T>
+            inline std::optional<T> maximum(const std::span<const C> column) noexcept
+            {
+                if constexpr (std::is_same_v<C, T>)
+                {
+                    if (column.empty())
+                    {
+                        return std::nullopt;
+                    }
+                    T ret{ column.front() };
+                    for (usize i{ 1_uz }; i != column.size(); ++i)
+                    {
+                        ret = ret < column[i] ? column[i] : ret;
+                    }
+                    return ret;
+                }
+                else
+                {
+                    const T* ret{ nullptr };
+                    for (const auto& cell : column)
+                    {
+                        const auto value = reduction_detail::value_of<T>(cell);
+                        if (value != nullptr && (ret == nullptr || *ret < *value))
+                        {
+                            ret = value;
+                        }
+                    }
+                    return ret != nullptr ? std::optional<T>{ *ret } : std::nullopt;
+                }
+            }
+
+            // amount of cells having a value of type T
+            template<typename T, typename C>
+            inline const usize count(const std::span<const C> column) noexcept
+            {
+                if constexpr (std::is_same_v<C, T>)
+                {
+                    return column.size();
+                }
+                else
+                {
+                    usize ret{ 0_uz };
+                    for (const auto& cell : column)
+                    {
+                        ret += reduction_detail::value_of<T>(cell) != nullptr ? 1_uz : 0_uz;
+                    }
+                    return ret;
+                }
+            }
+
+            // amount of cells having a value of type T that satisfies pred
+            template<typename T, typename C, typename F>
+                requires std::predicate<F, const T&>
+            inline const usize count(const std::span<const C> column, const F& pred) noexcept
+            {
+                usize ret{ 0_uz };
+                for (const auto& cell : column)
+                {
+                    const auto value = reduction_detail::value_of<T>(cell);
+                    ret += (value != nullptr && pred(*value)) ? 1_uz : 0_uz;
+                }
+                return ret;
+            }
+
+            // one byte per row, 1 if the cell has a value of type T that satisfies pred, masks of several columns can be combined with &
+            template<typename T, typename C, typename F>
+                requires std::predicate<F, const T&>
+            inline std::vector<u8> filter_mask(const std::span<const C> column, const F& pred) noexcept
+            {
+                std::vector<u8> ret(column.size(), 0_u8);
+                for (usize i{ 0_uz }; i != column.size(); ++i)
+                {
+                    const auto value = reduction_detail::value_of<T>(column[i]);
+                    ret[i] = (value != nullptr && pred(*value)) ? 1_u8 : 0_u8;
+                }
+                return ret;
+            }
+        };
+    };
+};
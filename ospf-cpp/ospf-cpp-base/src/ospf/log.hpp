@@ -5,5 +5,6 @@
 #include <ospf/log/interface.hpp>
 #include <ospf/log/level.hpp>
 #include <ospf/log/logger.hpp>
+#include <ospf/log/message.hpp>
 #include <ospf/log/record.hpp>
 #include <ospf/log/string.hpp>
@@ -0,0 +1,241 @@
+﻿#pragma once
+
+#include <ospf/basic_definition.hpp>
+#include <ospf/concepts/base.hpp>
+#include <ospf/literal_constant.hpp>
+#include <ospf/string/format.hpp>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+
+namespace ospf
+{
+    inline namespace log
+    {
+        namespace log_detail
+        {
+            // a deferred message with its arguments and format string fitting in so many bytes is kept inside of the record
+            static constexpr const usize deferred_message_inline_capacity = 1_uz << 7_uz;
+
+            // the writer thread may get to the record after the caller returned, so views and c-strings are copied
+            template<typename T, typename CharT>
+            struct DeferredArgument
+            {
+                using Type = std::decay_t<T>;
+            };
+
+            template<typename T, typename CharT>
+                requires (std::convertible_to<T, std::basic_string_view<CharT>> && !std::is_class_v<std::remove_cvref_t<T>>)
+                    || SameAs<std::remove_cvref_t<T>, std::basic_string_view<CharT>>
+            struct DeferredArgument<T, CharT>
+            {
+                using Type = std::basic_string<CharT>;
+            };
+
+            template<typename T, typename CharT>
+            using DeferredArgumentType = typename DeferredArgument<T, CharT>::Type;
+
+            // pointers, views and references still refer to the memory of the caller after being copied,
+            // a message with one of them is formatted when it is made
+            template<typename T>
+            struct NonOwningArgument
+                : public std::bool_constant<std::is_pointer_v<T> || std::ranges::view<T>> {};
+
+            template<typename T>
+            struct NonOwningArgument<std::reference_wrapper<T>>
+                : public std::true_type {};
+
+            template<typename T, typename CharT>
+            static constexpr const bool deferrable_argument = !NonOwningArgument<DeferredArgumentType<T, CharT>>::value;
+        };
+
+        // the message of a record, either a string made by the caller,
+        // or a format string with the copied arguments, formatted only when the record is written
+        template<CharType CharT = char>
+        class LogMessage
+        {
+        public:
+            using StringType = std::basic_string<CharT>;
+            using StringViewType = std::basic_string_view<CharT>;
+
+        private:
+            struct Table
+            {
+                void(*format)(const std::byte* payload, StringType& buffer);
+                void(*move)(std::byte* from, std::byte* to) noexcept;
+                void(*destroy)(std::byte* payload) noexcept;
+            };
+
+            // the format string is put right after the payload
+            template<typename... Args>
+            struct Payload
+            {
+                std::tuple<Args...> args;
+                usize length;
+
+                inline const StringViewType fmt(void) const noexcept
+                {
+                    return StringViewType{ reinterpret_cast<const CharT*>(reinterpret_cast<const std::byte*>(this) + sizeof(Payload)), length };
+                }
+
+                inline static constexpr const usize size(const usize length) noexcept
+                {
+                    return sizeof(Payload) + length * sizeof(CharT);
+                }
+
+                inline static void format(const std::byte* payload, StringType& buffer)
+                {
+                    const auto& self = *std::launder(reinterpret_cast<const Payload*>(payload));
+                    std::apply([&self, &buffer](const auto&... args)
+                        {
+                            std::vformat_to(std::back_inserter(buffer), self.fmt(), make_format_args<CharT>(args...));
+                        }, self.args);
+                }
+
+                inline static void move(std::byte* from, std::byte* to) noexcept
+                {
+                    auto& self = *std::launder(reinterpret_cast<Payload*>(from));
+                    std::memcpy(to + sizeof(Payload), from + sizeof(Payload), self.length * sizeof(CharT));
+                    std::construct_at(reinterpret_cast<Payload*>(to), std::move(self));
+                    std::destroy_at(&self);
+                }
+
+                inline static void destroy(std::byte* payload) noexcept
+                {
+                    std::destroy_at(std::launder(reinterpret_cast<Payload*>(payload)));
+                }
+
+                static constexpr const Table table{ &Payload::format, &Payload::move, &Payload::destroy };
+            };
+
+        public:
+            // the arguments are copied, or moved if they are rvalues, which may throw
+            template<typename... Args>
+            inline static LogMessage deferred(const StringViewType fmt, Args&&... args)
+            {
+                if constexpr (!(log_detail::deferrable_argument<Args, CharT> && ...))
+                {
+                    return LogMessage{ std::vformat(fmt, make_format_args<CharT>(std::forward<Args>(args)...)) };
+                }
+                else
+                {
+                    return make_deferred(fmt, std::forward<Args>(args)...);
+                }
+            }
+
+        private:
+            template<typename... Args>
+            inline static LogMessage make_deferred(const StringViewType fmt, Args&&... args)
+            {
+                using PayloadType = Payload<log_detail::DeferredArgumentType<Args, CharT>...>;
+                static_assert(alignof(PayloadType) <= alignof(std::max_align_t));
+
+                LogMessage ret{};
+                const auto size = PayloadType::size(fmt.size());
+                if (size > log_detail::deferred_message_inline_capacity)
+                {
+                    ret._heap = static_cast<std::byte*>(::operator new(size));
+                }
+                try
+                {
+                    std::construct_at(reinterpret_cast<PayloadType*>(ret.payload()), PayloadType{ { log_detail::DeferredArgumentType<Args, CharT>(std::forward<Args>(args))... }, fmt.size() });
+                }
+                catch (...)
+                {
+                    // the payload is not made, so the message does not release the heap block itself
+                    ::operator delete(ret._heap);
+                    ret._heap = nullptr;
+                    throw;
+                }
+                std::memcpy(ret.payload() + sizeof(PayloadType), fmt.data(), fmt.size() * sizeof(CharT));
+                ret._table = &PayloadType::table;
+                return ret;
+            }
+
+        public:
+            LogMessage(void) = default;
+            LogMessage(StringType message)
+                : _message(std::move(message)) {}
+            LogMessage(const LogMessage& ano) = delete;
+
+            LogMessage(LogMessage&& ano) noexcept
+                : _message(std::move(ano._message)), _table(ano._table), _heap(ano._heap)
+            {
+                if (_table != nullptr && _heap == nullptr)
+                {
+                    _table->move(ano._storage, _storage);
+                }
+                ano._table = nullptr;
+                ano._heap = nullptr;
+            }
+
+            LogMessage& operator=(const LogMessage& rhs) = delete;
+            LogMessage& operator=(LogMessage&& rhs) = delete;
+
+            ~LogMessage(void) noexcept
+            {
+                reset();
+            }
+
+        public:
+            inline const bool deferred(void) const noexcept
+            {
+                return _table != nullptr;
+            }
+
+            // the message, formatted into the buffer if it is deferred
+            inline const StringViewType view(StringType& buffer) const
+            {
+                if (_table == nullptr)
+                {
+                    return _message;
+                }
+                buffer.clear();
+                _table->format(payload(), buffer);
+                return buffer;
+            }
+
+            // the message, a deferred message is formatted and kept from now on
+            inline const StringViewType str(void) const
+            {
+                if (_table != nullptr)
+                {
+                    _table->format(payload(), _message);
+                    reset();
+                }
+                return _message;
+            }
+
+        private:
+            inline std::byte* payload(void) const noexcept
+            {
+                return _heap != nullptr ? _heap : const_cast<std::byte*>(_storage);
+            }
+
+            inline void reset(void) const noexcept
+            {
+                if (_table != nullptr)
+                {
+                    _table->destroy(payload());
+                    if (_heap != nullptr)
+                    {
+                        ::operator delete(_heap);
+                    }
+                    _table = nullptr;
+                    _heap = nullptr;
+                }
+            }
+
+        private:
+            mutable StringType _message;
+            mutable const Table* _table = nullptr;
+            mutable std::byte* _heap = nullptr;
+            alignas(std::max_align_t) std::byte _storage[log_detail::deferred_message_inline_capacity];
+        };
+    };
+};
@@ -0,0 +1,7 @@
+#include <ospf/log/multi_thread_impl.hpp>
+
+namespace ospf::log::log_detail
+{
+    template class MultiThreadImpl<char>;
+    template class MultiThreadImpl<wchar>;
+};
@@ -0,0 +1,377 @@
+﻿#pragma once
+
+#include <ospf/memory/pointer.hpp>
+#include <ospf/log/record.hpp>
+#include <ospf/ospf_base_api.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace ospf
+{
+    inline namespace log
+    {
+        // what a producer does when the ring of a multi-thread logger is full
+        enum class LogOverflowPolicy : u8
+        {
+            // wait until the writer thread frees a slot
+            Block,
+            // discard the record, the amount of discarded records is counted
+            Drop,
+            // put the record into an unbounded list behind the ring,
+            // taken by the writer thread after the records claimed in the ring before it, so that the order of every producer is kept
+            Spill
+        };
+
+        namespace log_detail
+        {
+            static constexpr const usize default_log_ring_capacity = 1_uz << 12_uz;
+            // a buffered logger wakes its writer thread once for so many records
+            static constexpr const usize log_wakeup_batch = 1_uz << 6_uz;
+            // a buffered logger writes what it has at least this often
+            static constexpr const auto log_wakeup_interval = std::chrono::milliseconds{ 10 };
+
+            // records are put into a bounded lock-free ring by any thread and written by one writer thread
+            // every slot carries a sequence number: pos + 1 when the record at pos is published, pos + capacity when it is taken
+            template<CharType CharT>
+            class MultiThreadImpl
+            {
+                struct Slot
+                {
+                    std::atomic<usize> sequence;
+                    alignas(LogRecord<CharT>) std::byte storage[sizeof(LogRecord<CharT>)];
+
+                    inline LogRecord<CharT>& record(void) noexcept
+                    {
+                        return *std::launder(reinterpret_cast<LogRecord<CharT>*>(storage));
+                    }
+                };
+
+            public:
+                MultiThreadImpl(const bool with_buffer, const usize capacity = default_log_ring_capacity, const LogOverflowPolicy policy = LogOverflowPolicy::Block)
+                    : _with_buffer(with_buffer), _policy(policy), _finished(false), _sleeping(false), _blocked(0_uz), _dropped(0_uz), _spill_amount(0_uz), _spill_written(0_uz), _spill_tail(0_uz), _spill_total(0_uz),
+                    _capacity(std::bit_ceil((std::max)(capacity, 2_uz))), _slots(std::make_unique<Slot[]>(_capacity)), _head(0_uz), _tail(0_uz)
+                {
+                    for (usize i{ 0_uz }; i != _capacity; ++i)
+                    {
+                        _slots[i].sequence.store(i, std::memory_order_relaxed);
+                    }
+                    _thread = make_unique<std::thread>([this]()
+                        {
+                            this->worker();
+                        });
+                }
+
+            public:
+                MultiThreadImpl(const MultiThreadImpl& ano) = delete;
+                MultiThreadImpl(MultiThreadImpl&& ano) noexcept = default;
+                MultiThreadImpl& operator=(const MultiThreadImpl& rhs) = delete;
+                MultiThreadImpl& operator=(MultiThreadImpl&& rhs) = delete;
+
+            public:
+                ~MultiThreadImpl(void)
+                {
+                    if (!_finished)
+                    {
+                        join();
+                    }
+                }
+
+            public:
+                inline const usize capacity(void) const noexcept
+                {
+                    return _capacity;
+                }
+
+                inline const LogOverflowPolicy overflow_policy(void) const noexcept
+                {
+                    return _policy.load(std::memory_order_relaxed);
+                }
+
+                inline void set_overflow_policy(const LogOverflowPolicy policy) noexcept
+                {
+                    _policy.store(policy, std::memory_order_relaxed);
+                }
+
+                // amount of records discarded by LogOverflowPolicy::Drop
+                inline const usize dropped_amount(void) const noexcept
+                {
+                    return _dropped.load(std::memory_order_relaxed);
+                }
+
+            public:
+                inline void add(LogRecord<CharT> record) noexcept
+                {
+                    // while the spilled list is not empty, records follow it to keep the order of every producer
+                    if (_spill_amount.load(std::memory_order_acquire) != 0_uz)
+                    {
+                        spill(std::move(record));
+                        return;
+                    }
+
+                    auto pos = _tail.load(std::memory_order_relaxed);
+                    while (true)
+                    {
+                        auto& slot = _slots[pos & (_capacity - 1_uz)];
+                        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+                        const auto diff = static_cast<isize>(sequence) - static_cast<isize>(pos);
+                        if (diff == 0_iz)
+                        {
+                            if (_tail.compare_exchange_weak(pos, pos + 1_uz, std::memory_order_relaxed))
+                            {
+                                std::construct_at(reinterpret_cast<LogRecord<CharT>*>(slot.storage), std::move(record));
+                                slot.sequence.store(pos + 1_uz, std::memory_order_release);
+                                notify(!_with_buffer || pos + 1_uz - _head.load(std::memory_order_relaxed) >= log_wakeup_batch);
+                                return;
+                            }
+                        }
+                        else if (diff < 0_iz)
+                        {
+                            // the slot of the last round is not taken yet, the ring is full
+                            switch (_policy.load(std::memory_order_relaxed))
+                            {
+                            case LogOverflowPolicy::Drop:
+                                _dropped.fetch_add(1_uz, std::memory_order_relaxed);
+                                return;
+                            case LogOverflowPolicy::Spill:
+                                spill(std::move(record));
+                                return;
+                            default:
+                                wait_for_slot();
+                                pos = _tail.load(std::memory_order_relaxed);
+                                break;
+                            }
+                        }
+                        else
+                        {
+                            pos = _tail.load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                inline void join(void) noexcept
+                {
+                    _finished = true;
+                    wake();
+                    if (_thread->joinable())
+                    {
+                        _thread->join();
+                    }
+                }
+
+                // wait until the records added before are written,
+                // the waiting is counted as blocked, so that the writer thread notifies it as it does the blocked producers
+                inline void flush(void) noexcept
+                {
+                    const auto target = _tail.load(std::memory_order_acquire);
+                    usize spill_target{ 0_uz };
+                    {
+                        std::lock_guard<std::mutex> lck{ _spill_mutex };
+                        spill_target = _spill_total;
+                    }
+                    _blocked.fetch_add(1_uz, std::memory_order_seq_cst);
+                    wake();
+                    for (auto head = _head.load(std::memory_order_acquire); head < target; head = _head.load(std::memory_order_acquire))
+                    {
+                        _head.wait(head, std::memory_order_acquire);
+                    }
+                    for (auto written = _spill_written.load(std::memory_order_acquire); written < spill_target; written = _spill_written.load(std::memory_order_acquire))
+                    {
+                        _spill_written.wait(written, std::memory_order_acquire);
+                    }
+                    _blocked.fetch_sub(1_uz, std::memory_order_relaxed);
+                }
+
+            private:
+                inline void notify(const bool urgent) noexcept
+                {
+                    // pairs with the fence of the writer thread going to sleep, so that one of them sees the other
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (urgent && _sleeping.load(std::memory_order_relaxed))
+                    {
+                        wake();
+                    }
+                }
+
+                inline void wake(void) noexcept
+                {
+                    {
+                        std::lock_guard<std::mutex> lck{ _mutex };
+                    }
+                    _condition.notify_one();
+                }
+
+                inline void wait_for_slot(void) noexcept
+                {
+                    _blocked.fetch_add(1_uz, std::memory_order_seq_cst);
+                    const auto head = _head.load(std::memory_order_acquire);
+                    if (_tail.load(std::memory_order_relaxed) - head >= _capacity)
+                    {
+                        wake();
+                        _head.wait(head, std::memory_order_acquire);
+                    }
+                    _blocked.fetch_sub(1_uz, std::memory_order_relaxed);
+                }
+
+                inline void spill(LogRecord<CharT> record) noexcept
+                {
+                    {
+                        std::lock_guard<std::mutex> lck{ _spill_mutex };
+                        _spilled.push_back(std::move(record));
+                        // the tail only grows, so the one of the last spilled record covers the ring records of every producer before the list
+                        _spill_tail = _tail.load(std::memory_order_acquire);
+                        ++_spill_total;
+                        _spill_amount.fetch_add(1_uz, std::memory_order_release);
+                    }
+                    notify(true);
+                }
+
+                inline const bool pending(void) noexcept
+                {
+                    return _slots[_head.load(std::memory_order_relaxed) & (_capacity - 1_uz)].sequence.load(std::memory_order_acquire) == _head.load(std::memory_order_relaxed) + 1_uz
+                        || _spill_amount.load(std::memory_order_acquire) != 0_uz;
+                }
+
+                // write the records in the ring from head, up to end if it is given, waiting for the ones claimed but not published yet,
+                // otherwise until the first one not published, return the amount of them
+                inline const usize drain_ring(usize& head, const std::optional<usize> end) noexcept
+                {
+                    usize amount{ 0_uz };
+                    while (!end.has_value() || head < *end)
+                    {
+                        auto& slot = _slots[head & (_capacity - 1_uz)];
+                        if (slot.sequence.load(std::memory_order_acquire) != head + 1_uz)
+                        {
+                            if (!end.has_value())
+                            {
+                                break;
+                            }
+                            std::this_thread::yield();
+                            continue;
+                        }
+                        auto& record = slot.record();
+                        record.write();
+                        std::destroy_at(&record);
+                        slot.sequence.store(head + _capacity, std::memory_order_release);
+                        ++head;
+                        ++amount;
+                        if (amount % log_wakeup_batch == 0_uz)
+                        {
+                            release(head);
+                        }
+                    }
+                    return amount;
+                }
+
+                // write what is published in the ring, and then the spilled records, return the amount of them
+                inline const usize drain(void) noexcept
+                {
+                    auto head = _head.load(std::memory_order_relaxed);
+                    auto amount = drain_ring(head, std::nullopt);
+                    if (_spill_amount.load(std::memory_order_acquire) != 0_uz)
+                    {
+                        std::vector<LogRecord<CharT>> spilled;
+                        usize spill_tail{ 0_uz };
+                        {
+                            std::lock_guard<std::mutex> lck{ _spill_mutex };
+                            std::swap(spilled, _spilled);
+                            spill_tail = _spill_tail;
+                        }
+                        // a producer may have claimed a slot before spilling, which is to be written first
+                        amount += drain_ring(head, spill_tail);
+                        for (const auto& record : spilled)
+                        {
+                            record.write();
+                        }
+                        amount += spilled.size();
+                        _spill_amount.fetch_sub(spilled.size(), std::memory_order_release);
+                        _spill_written.fetch_add(spilled.size(), std::memory_order_release);
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        if (_blocked.load(std::memory_order_relaxed) != 0_uz)
+                        {
+                            _spill_written.notify_all();
+                        }
+                    }
+                    release(head);
+                    return amount;
+                }
+
+                inline void release(const usize head) noexcept
+                {
+                    _head.store(head, std::memory_order_release);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (_blocked.load(std::memory_order_relaxed) != 0_uz)
+                    {
+                        _head.notify_all();
+                    }
+                }
+
+                inline void worker(void) noexcept
+                {
+                    while (true)
+                    {
+                        if (drain() != 0_uz)
+                        {
+                            continue;
+                        }
+                        if (_finished)
+                        {
+                            break;
+                        }
+
+                        std::unique_lock<std::mutex> lck{ _mutex };
+                        _sleeping.store(true, std::memory_order_relaxed);
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        if (!_finished && !pending())
+                        {
+                            if (_with_buffer)
+                            {
+                                _condition.wait_for(lck, log_wakeup_interval);
+                            }
+                            else
+                            {
+                                _condition.wait(lck);
+                            }
+                        }
+                        _sleeping.store(false, std::memory_order_relaxed);
+                    }
+                    // records added after finished are still written
+                    drain();
+                }
+
+            private:
+                bool _with_buffer;
+                std::atomic<LogOverflowPolicy> _policy;
+                std::atomic<bool> _finished;
+                std::atomic<bool> _sleeping;
+                std::atomic<usize> _blocked;
+                std::atomic<usize> _dropped;
+                std::atomic<usize> _spill_amount;
+                std::atomic<usize> _spill_written;
+                std::mutex _mutex;
+                std::condition_variable _condition;
+                std::mutex _spill_mutex;
+                std::vector<LogRecord<CharT>> _spilled;
+                usize _spill_tail;
+                usize _spill_total;
+                usize _capacity;
+                std::unique_ptr<Slot[]> _slots;
+                alignas(64) std::atomic<usize> _head;
+                alignas(64) std::atomic<usize> _tail;
+                Unique<std::thread> _thread;
+            };
+
+            extern template class MultiThreadImpl<char>;
+            extern template class MultiThreadImpl<wchar>;
+        };
+    };
+};
@@ -0,0 +1,7 @@
+﻿#include <ospf/log/record.hpp>
+
+namespace ospf::log
+{
+    template class LogRecord<char>;
+    template class LogRecord<wchar>;
+};
@@ -0,0 +1,106 @@
+﻿#pragma once
+
+#include <ospf/basic_definition.hpp>
+#include <ospf/concepts/base.hpp>
+#include <ospf/concepts/enum.hpp>
+#include <ospf/log/level.hpp>
+#include <ospf/log/message.hpp>
+#include <ospf/memory/reference.hpp>
+#include <ospf/string/format.hpp>
+#include <chrono>
+#include <functional>
+#include <iterator>
+#include <ostream>
+
+namespace ospf
+{
+    inline namespace log
+    {
+        template<CharType CharT = char>
+        class LogRecord
+        {
+        public:
+            using DateTimeType = std::chrono::system_clock::time_point;
+            using StringType = std::basic_string<CharT>;
+            using StringViewType = std::basic_string_view<CharT>;
+            using MessageType = LogMessage<CharT>;
+            using OutputStreamType = std::basic_ostream<CharT>;
+            using Writer = std::function<void(const DateTimeType time, const LogLevel level, const StringViewType message)>;
+            using WriterGenerator = std::function<Writer(OutputStreamType&)>;
+
+        public:
+            static Writer default_writer(OutputStreamType& os) noexcept
+            {
+                return [&os](const DateTimeType time, const LogLevel level, const StringViewType message)
+                {
+                    if (level != LogLevel::Other)
+                    {
+                        if constexpr (DecaySameAs<CharT, char>)
+                        {
+                            std::format_to(std::ostreambuf_iterator<CharT>{ os }, "[{0}] {1:%F}T{1:%T%z}: {2}\n", level, time, message);
+                        }
+                        else if constexpr (DecaySameAs<CharT, wchar>)
+                        {
+                            std::format_to(std::ostreambuf_iterator<CharT>{ os }, L"[{0}] {1:%F}T{1:%T%z}: {2}\n", level, time, message);
+                        }
+                        //else
+                        //{
+                        //    static_assert(false, "unsupported character type");
+                        //}
+                    }
+                    else
+                    {
+                        os << message << '\n';
+                    }
+                };
+            }
+
+        public:
+            LogRecord(const LogLevel level, MessageType message, const Writer& writer)
+                : _time(std::chrono::system_clock::now()), _level(level), _message(std::move(message)), _writer(writer) {}
+            LogRecord(const LogRecord& ano) = delete;
+            LogRecord(LogRecord&& ano) = default;
+            LogRecord& operator=(const LogRecord& rhs) = delete;
+            LogRecord& operator=(LogRecord&& rhs) = delete;
+            ~LogRecord(void) = default;
+
+        public:
+            inline const DateTimeType time(void) const noexcept
+            {
+                return _time;
+            }
+
+            inline const LogLevel level(void) const noexcept
+            {
+                return _level;
+            }
+
+            inline const StringViewType message(void) const noexcept
+            {
+                return _message.str();
+            }
+
+            inline const Writer& writer(void) const noexcept
+            {
+                return *_writer;
+            }
+
+        public:
+            // a deferred message is formatted here, on the thread writing the record, into a buffer reused by the records of this thread
+            inline void write(void) const noexcept
+            {
+                thread_local StringType buffer;
+                (*_writer)(_time, _level, _message.view(buffer));
+            }
+
+        private:
+            DateTimeType _time;
+            LogLevel _level;
+            MessageType _message;
+            Ref<Writer> _writer;
+        };
+
+        extern template class LogRecord<char>;
+        extern template class LogRecord<wchar>;
+    };
+};
@@ -12,6 +12,6 @@ namespace ospf
     inline namespace memory
     {
         template<typename T, ObjectPoolMultiThread mt = OSPF_BASE_MULTI_THREAD>
-        using ObjectPool = pool::ObjectPool<OriginType<T>, boost::object_pool<OriginType<T>>, mt>;
+        using ObjectPool = pool::ObjectPool<OriginType<T>, boost::object_pool<pool::PoolElementType<OriginType<T>, mt>>, mt>;
     };
 };
@@ -13,6 +13,16 @@ namespace ospf
         {
             template<typename T, typename Pool, ObjectPoolMultiThread mt>
             class ObjectPool;
+
+            // element type of the underlying pool that ObjectPool<T, Pool, mt> allocates from
+            template<typename T, ObjectPoolMultiThread mt>
+            struct PoolElementTrait
+            {
+                using Type = T;
+            };
+
+            template<typename T, ObjectPoolMultiThread mt>
+            using PoolElementType = typename PoolElementTrait<T, mt>::Type;
         };
 
         template<typename T, typename Pool, ObjectPoolMultiThread mt, typename... Args>
@@ -2,7 +2,13 @@
 
 #include <ospf/memory/pool/concept.hpp>
 #include <ospf/memory/reference.hpp>
+#include <atomic>
+#include <cstddef>
 #include <mutex>
+#include <new>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
 
 namespace ospf
 {
@@ -10,14 +16,350 @@ namespace ospf
     {
         namespace pool
         {
+            namespace multi_thread_detail
+            {
+                template<typename T>
+                struct Cache;
+
+                // storage of an object in the underlying pool, the object is placed at the beginning of its slot
+                template<typename T>
+                struct Slot
+                {
+                    Slot(void) noexcept
+                        : next(nullptr), next_batch(nullptr), home(nullptr), alive(false) {}
+                    Slot(const Slot& ano) = delete;
+                    Slot(Slot&& ano) = delete;
+                    Slot& operator=(const Slot& rhs) = delete;
+                    Slot& operator=(Slot&& rhs) = delete;
+
+                    // the underlying pool destroys every slot when it is destroyed, objects still alive are destroyed with them
+                    ~Slot(void) noexcept
+                    {
+                        if (alive)
+                        {
+                            object()->~T();
+                        }
+                    }
+
+                    inline PtrType<T> object(void) noexcept
+                    {
+                        return std::launder(reinterpret_cast<PtrType<T>>(storage));
+                    }
+
+                    inline static Slot* from(const PtrType<T> ptr) noexcept
+                    {
+                        return reinterpret_cast<Slot*>(reinterpret_cast<std::byte*>(ptr));
+                    }
+
+                    alignas(T) std::byte storage[sizeof(T)];
+                    Slot* next;
+                    Slot* next_batch;           // only used by the first slot of a batch in the global stack
+                    Cache<T>* home;             // cache of the thread which allocated the object
+                    bool alive;
+                };
+
+                // free-list of a thread, objects freed by other threads are pushed to remote and taken back in bulk
+                template<typename T>
+                struct Cache
+                {
+                    Slot<T>* local{ nullptr };
+                    usize local_size{ 0_uz };
+                    std::atomic<Slot<T>*> remote{ nullptr };
+                };
+
+                inline const u64 next_pool_id(void) noexcept
+                {
+                    static std::atomic<u64> id{ 0_u64 };
+                    return id.fetch_add(1_u64, std::memory_order_relaxed) + 1_u64;
+                }
+
+                // ids of the pools alive, a thread giving up its cache of a pool checks it under the mutex,
+                // so that the pool cannot be destroyed meanwhile
+                struct AlivePools
+                {
+                    std::mutex mutex;
+                    std::unordered_set<u64> ids;
+                };
+
+                inline AlivePools& alive_pools(void) noexcept
+                {
+                    static AlivePools pools;
+                    return pools;
+                }
+
+                // shared by a pool and its deleters, it stays in place when the pool is moved
+                // allocation and deallocation only touch the cache of the current thread,
+                // caches exchange batches of free slots through a lock-free global stack,
+                // the mutex is only taken to register a thread or to refill from the underlying pool
+                // a cache given up by its thread, because the thread exits or drops the entry of the pool, is retired with its free slots,
+                // and the next thread registering to the pool adopts it instead of a new one, so that no slot is stranded
+                template<typename T, typename Pool>
+                class State
+                {
+                public:
+                    static constexpr const usize batch_size = 64_uz;
+                    static constexpr const usize max_thread_entry = 32_uz;
+
+                private:
+                    struct ThreadEntry
+                    {
+                        u64 last_id{ 0_u64 };
+                        Cache<T>* last_cache{ nullptr };
+                        std::vector<std::tuple<u64, State*, Cache<T>*>> caches;
+
+                        ~ThreadEntry(void) noexcept
+                        {
+                            for (const auto& [id, state, cache] : caches)
+                            {
+                                retire(id, *state, *cache);
+                            }
+                        }
+                    };
+
+                public:
+                    State(void)
+                        : _id(next_pool_id())
+                    {
+                        auto& pools = alive_pools();
+                        std::lock_guard<std::mutex> guard{ pools.mutex };
+                        pools.ids.insert(_id);
+                    }
+
+                    State(const State& ano) = delete;
+                    State(State&& ano) = delete;
+                    State& operator=(const State& rhs) = delete;
+                    State& operator=(State&& rhs) = delete;
+
+                    ~State(void) noexcept
+                    {
+                        auto& pools = alive_pools();
+                        std::lock_guard<std::mutex> guard{ pools.mutex };
+                        pools.ids.erase(_id);
+                    }
+
+                public:
+                    inline Slot<T>* acquire(void) noexcept
+                    {
+                        auto& cache = local_cache();
+                        if (cache.local == nullptr)
+                        {
+                            refill(cache);
+                            if (cache.local == nullptr)
+                            {
+                                return nullptr;
+                            }
+                        }
+                        auto slot = cache.local;
+                        cache.local = slot->next;
+                        --cache.local_size;
+                        slot->next = nullptr;
+                        slot->home = &cache;
+                        return slot;
+                    }
+
+                    inline void release(Slot<T>* const slot) noexcept
+                    {
+                        auto home = slot->home;
+                        if (home == current_cache())
+                        {
+                            slot->next = home->local;
+                            home->local = slot;
+                            ++home->local_size;
+                            if (home->local_size >= 2_uz * batch_size)
+                            {
+                                spill(*home);
+                            }
+                        }
+                        else
+                        {
+                            auto head = home->remote.load(std::memory_order_relaxed);
+                            do
+                            {
+                                slot->next = head;
+                            } while (!home->remote.compare_exchange_weak(head, slot, std::memory_order_release, std::memory_order_relaxed));
+                        }
+                    }
+
+                private:
+                    inline static ThreadEntry& thread_entry(void) noexcept
+                    {
+                        static thread_local ThreadEntry entry;
+                        return entry;
+                    }
+
+                    // the cache goes back to the pool if the pool is still alive, otherwise its slots have been destroyed with the pool
+                    inline static void retire(const u64 id, State& state, Cache<T>& cache) noexcept
+                    {
+                        auto& pools = alive_pools();
+                        std::lock_guard<std::mutex> guard{ pools.mutex };
+                        if (pools.ids.contains(id))
+                        {
+                            std::lock_guard<std::mutex> state_guard{ state._mutex };
+                            state._retired_caches.push_back(&cache);
+                        }
+                    }
+
+                    inline Cache<T>* current_cache(void) const noexcept
+                    {
+                        auto& entry = thread_entry();
+                        if (entry.last_id == _id)
+                        {
+                            return entry.last_cache;
+                        }
+                        for (const auto& [id, state, cache] : entry.caches)
+                        {
+                            if (id == _id)
+                            {
+                                entry.last_id = id;
+                                entry.last_cache = cache;
+                                return cache;
+                            }
+                        }
+                        return nullptr;
+                    }
+
+                    inline Cache<T>& local_cache(void) noexcept
+                    {
+                        auto cache = current_cache();
+                        if (cache != nullptr)
+                        {
+                            return *cache;
+                        }
+
+                        {
+                            std::lock_guard<std::mutex> guard{ _mutex };
+                            if (!_retired_caches.empty())
+                            {
+                                // its free slots and the slots freed into its remote list meanwhile come along
+                                cache = _retired_caches.back();
+                                _retired_caches.pop_back();
+                            }
+                            else
+                            {
+                                _caches.push_back(make_unique<Cache<T>>());
+                                cache = &*_caches.back();
+                            }
+                        }
+                        // the entry of the longest-registered pool is dropped when the thread has too many,
+                        // its cache is retired, and the thread adopts a retired cache when it comes back
+                        auto& entry = thread_entry();
+                        if (entry.caches.size() == max_thread_entry)
+                        {
+                            const auto [id, state, dropped] = entry.caches.front();
+                            entry.caches.erase(entry.caches.begin());
+                            retire(id, *state, *dropped);
+                        }
+                        entry.caches.emplace_back(_id, this, cache);
+                        entry.last_id = _id;
+                        entry.last_cache = cache;
+                        return *cache;
+                    }
+
+                    inline void refill(Cache<T>& cache) noexcept
+                    {
+                        // slots freed by other threads first
+                        auto remote = cache.remote.exchange(nullptr, std::memory_order_acquire);
+                        if (remote != nullptr)
+                        {
+                            usize size{ 0_uz };
+                            for (auto slot = remote; slot != nullptr; slot = slot->next)
+                            {
+                                ++size;
+                            }
+                            cache.local = remote;
+                            cache.local_size = size;
+                            return;
+                        }
+
+                        // then a batch spilled by any thread
+                        // the whole stack is taken at once and the rest is pushed back, which keeps it free of ABA
+                        auto batch = _global.exchange(nullptr, std::memory_order_acquire);
+                        if (batch != nullptr)
+                        {
+                            auto rest = batch->next_batch;
+                            batch->next_batch = nullptr;
+                            if (rest != nullptr)
+                            {
+                                auto tail = rest;
+                                while (tail->next_batch != nullptr)
+                                {
+                                    tail = tail->next_batch;
+                                }
+                                push_batches(rest, tail);
+                            }
+                            cache.local = batch;
+                            cache.local_size = batch_size;
+                            return;
+                        }
+
+                        // then fresh slots from the underlying pool
+                        std::lock_guard<std::mutex> guard{ _mutex };
+                        for (usize i{ 0_uz }; i != batch_size; ++i)
+                        {
+                            auto ptr = _pool.malloc();
+                            if (ptr == nullptr)
+                            {
+                                break;
+                            }
+                            auto slot = ::new (ptr) Slot<T>{};
+                            slot->next = cache.local;
+                            cache.local = slot;
+                            ++cache.local_size;
+                        }
+                    }
+
+                    inline void spill(Cache<T>& cache) noexcept
+                    {
+                        auto batch = cache.local;
+                        auto tail = batch;
+                        for (usize i{ 1_uz }; i != batch_size; ++i)
+                        {
+                            tail = tail->next;
+                        }
+                        cache.local = tail->next;
+                        cache.local_size -= batch_size;
+                        tail->next = nullptr;
+                        push_batches(batch, batch);
+                    }
+
+                    inline void push_batches(Slot<T>* const head, Slot<T>* const tail) noexcept
+                    {
+                        auto top = _global.load(std::memory_order_relaxed);
+                        do
+                        {
+                            tail->next_batch = top;
+                        } while (!_global.compare_exchange_weak(top, head, std::memory_order_release, std::memory_order_relaxed));
+                    }
+
+                private:
+                    u64 _id;
+                    std::mutex _mutex;
+                    Pool _pool;
+                    std::vector<Unique<Cache<T>>> _caches;
+                    std::vector<Cache<T>*> _retired_caches;
+                    std::atomic<Slot<T>*> _global{ nullptr };
+                };
+            };
+
+            template<typename T>
+            struct PoolElementTrait<T, on>
+            {
+                using Type = multi_thread_detail::Slot<T>;
+            };
+
+            // Pool is expected to allocate PoolElementType<T, on>, and to destroy its elements when it is destroyed
             template<typename T, typename Pool>
             class ObjectPool<T, Pool, on>
             {
+            public:
+                using StateType = multi_thread_detail::State<T, Pool>;
+                using SlotType = multi_thread_detail::Slot<T>;
+
             public:
                 struct Deleter
                 {
-                    Deleter(const std::mutex& m, const Pool& p)
-                        : mutex(m), pool(p) {}
+                    Deleter(const StateType& s)
+                        : state(s) {}
                     Deleter(const Deleter& ano) = default;
                     Deleter(Deleter&& ano) noexcept = default;
                     Deleter& operator=(const Deleter& rhs) = default;
@@ -26,40 +368,43 @@ namespace ospf
 
                     inline void operator()(const PtrType<T> ptr) const noexcept
                     {
-                        std::lock_guard<std::mutex> guard{ *mutex };
-                        pool->destory(ptr);
+                        auto slot = SlotType::from(ptr);
+                        ptr->~T();
+                        slot->alive = false;
+                        state->release(slot);
                     }
 
-                    mutable Ref<std::mutex> mutex;
-                    mutable Ref<Pool> pool;
+                    mutable Ref<StateType> state;
                 };
 
                 template<typename U>
                     requires std::convertible_to<PtrType<T>, PtrType<U>>
                 struct BaseDeleter
                 {
-                    BaseDeleter(const std::mutex& m, const Pool& p)
-                        : mutex(m), pool(p) {}
+                    BaseDeleter(const StateType& s)
+                        : state(s) {}
                     BaseDeleter(const BaseDeleter& ano) = default;
-                    BaseDeleter(Deleter&& ano) noexcept = default;
+                    BaseDeleter(BaseDeleter&& ano) noexcept = default;
                     BaseDeleter& operator=(const BaseDeleter& rhs) = default;
                     BaseDeleter& operator=(BaseDeleter&& rhs) noexcept = default;
                     ~BaseDeleter(void) noexcept = default;
 
                     inline void operator()(const PtrType<U> ptr) const noexcept
                     {
-                        std::lock_guard<std::mutex> guard{ *mutex };
                         auto temp = static_cast<const PtrType<T>>(ptr);
                         assert(temp != nullptr);
-                        pool->destory(temp);
+                        auto slot = SlotType::from(temp);
+                        temp->~T();
+                        slot->alive = false;
+                        state->release(slot);
                     }
 
-                    mutable Ref<std::mutex> mutex;
-                    mutable Ref<Pool> pool;
+                    mutable Ref<StateType> state;
                 };
 
             public:
-                ObjectPool(void) = default;
+                ObjectPool(void)
+                    : _state(ospf::make_unique<StateType>()) {}
                 ObjectPool(const ObjectPool& ano) = delete;
                 ObjectPool(ObjectPool&& ano) noexcept = default;
                 ObjectPool& operator=(const ObjectPool& rhs) = delete;
@@ -112,22 +457,34 @@ namespace ospf
             public:
                 inline decltype(auto) deleter(void) const noexcept
                 {
-                    return Deleter{ _mutex, _pool };
+                    return Deleter{ *_state };
                 }
 
                 template<typename U>
                     requires std::convertible_to<PtrType<U>, PtrType<T>>
                 inline decltype(auto) base_deleter(void) const noexcept
                 {
-                    return BaseDeleter<U>{ _mutex, _pool };
+                    return BaseDeleter<U>{ *_state };
                 }
 
             private:
+                template<typename... Args>
+                inline PtrType<T> construct(Args&&... args) noexcept
+                {
+                    auto slot = _state->acquire();
+                    if (slot == nullptr)
+                    {
+                        return nullptr;
+                    }
+                    auto ptr = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+                    slot->alive = true;
+                    return ptr;
+                }
+
                 template<PointerCategory cat, typename... Args>
                 inline decltype(auto) make_ptr_from_pool(Args&&... args) noexcept
                 {
-                    std::lock_guard<std::mutex> guard{ _mutex };
-                    auto ptr = _pool.malloc();
+                    auto ptr = construct(std::forward<Args>(args)...);
                     if (ptr == nullptr)
                     {
                         return pointer::Ptr<T, cat>{};
@@ -136,11 +493,11 @@ namespace ospf
                     {
                         if constexpr (cat == PointerCategory::Raw)
                         {
-                            return pointer::Ptr<T, cat>{ ::new (ptr) T(std::forward<Args>(args)...) };
+                            return pointer::Ptr<T, cat>{ ptr };
                         }
                         else
                         {
-                            return pointer::Ptr<T, cat>{ ::new (ptr) T(std::forward<Args>(args)...), deleter() };
+                            return pointer::Ptr<T, cat>{ ptr, deleter() };
                         }
                     }
                 }
@@ -149,8 +506,7 @@ namespace ospf
                     requires std::convertible_to<PtrType<T>, PtrType<U>>
                 inline decltype(auto) make_base_ptr_from_pool(Args&&... args) noexcept
                 {
-                    std::lock_guard<std::mutex> guard{ _mutex };
-                    auto ptr = _pool.malloc();
+                    auto ptr = construct(std::forward<Args>(args)...);
                     if (ptr == nullptr)
                     {
                         return pointer::Ptr<U, cat>{};
@@ -159,18 +515,17 @@ namespace ospf
                     {
                         if constexpr (cat == PointerCategory::Raw)
                         {
-                            return pointer::Ptr<U, cat>{ static_cast<PtrType<U>>(::new (ptr) T(std::forward<Args>(args)...)) };
+                            return pointer::Ptr<U, cat>{ static_cast<PtrType<U>>(ptr) };
                         }
                         else
                         {
-                            return pointer::Ptr<U, cat>{ static_cast<PtrType<U>>(::new (ptr) T(std::forward<Args>(args)...)), base_deleter<U>() };
+                            return pointer::Ptr<U, cat>{ static_cast<PtrType<U>>(ptr), base_deleter<U>() };
                         }
                     }
                 }
 
             private:
-                std::mutex _mutex;
-                Pool _pool;
+                Unique<StateType> _state;
             };
         };
     };
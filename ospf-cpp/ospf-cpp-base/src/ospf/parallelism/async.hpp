@@ -1,3 +1,246 @@
 #pragma once
 
-// todo
+#include <ospf/parallelism/task.hpp>
+#include <ospf/parallelism/thread_pool.hpp>
+#include <atomic>
+#include <exception>
+#include <vector>
+
+namespace ospf
+{
+    inline namespace parallelism
+    {
+        namespace async_detail
+        {
+            // eagerly started coroutine that destroys itself when finished
+            // nobody awaits it, so its body catches the exceptions of the task it runs and hands them over to the awaiting side
+            struct DetachedTask
+            {
+                struct promise_type
+                {
+                    inline constexpr DetachedTask get_return_object(void) const noexcept
+                    {
+                        return {};
+                    }
+
+                    inline constexpr std::suspend_never initial_suspend(void) const noexcept
+                    {
+                        return {};
+                    }
+
+                    inline constexpr std::suspend_never final_suspend(void) const noexcept
+                    {
+                        return {};
+                    }
+
+                    inline constexpr void return_void(void) const noexcept {}
+
+                    inline void unhandled_exception(void) const noexcept
+                    {
+                        std::terminate();
+                    }
+                };
+            };
+
+            // resumes its awaiter after count arrivals, the awaiter itself counts as the last one
+            class Latch
+            {
+            public:
+                Latch(const usize count)
+                    : _count(count + 1_uz) {}
+                Latch(const Latch& ano) = delete;
+                Latch(Latch&& ano) = delete;
+                Latch& operator=(const Latch& rhs) = delete;
+                Latch& operator=(Latch&& rhs) = delete;
+                ~Latch(void) noexcept = default;
+
+            public:
+                inline void arrive(void) noexcept
+                {
+                    if (_count.fetch_sub(1_uz, std::memory_order_acq_rel) == 1_uz)
+                    {
+                        _awaiting.resume();
+                    }
+                }
+
+            public:
+                inline constexpr const bool await_ready(void) const noexcept
+                {
+                    return false;
+                }
+
+                inline bool await_suspend(const std::coroutine_handle<> awaiting) noexcept
+                {
+                    _awaiting = awaiting;
+                    return _count.fetch_sub(1_uz, std::memory_order_acq_rel) != 1_uz;
+                }
+
+                inline constexpr void await_resume(void) const noexcept {}
+
+            private:
+                std::atomic<usize> _count;
+                std::coroutine_handle<> _awaiting;
+            };
+        };
+
+        // co_await schedule(pool) moves the rest of the coroutine onto a worker of pool
+        class ScheduleAwaiter
+        {
+        public:
+            ScheduleAwaiter(ThreadPool& pool) noexcept
+                : _pool(&pool) {}
+
+        public:
+            inline constexpr const bool await_ready(void) const noexcept
+            {
+                return false;
+            }
+
+            inline void await_suspend(const std::coroutine_handle<> awaiting) noexcept
+            {
+                _pool->submit([awaiting]()
+                    {
+                        awaiting.resume();
+                    });
+            }
+
+            inline constexpr void await_resume(void) const noexcept {}
+
+        private:
+            ThreadPool* _pool;
+        };
+
+        inline ScheduleAwaiter schedule(ThreadPool& pool = ThreadPool::instance()) noexcept
+        {
+            return ScheduleAwaiter{ pool };
+        }
+
+        // start the task on the pool, the returned future is fulfilled when it finishes
+        // an exception thrown by the task is stored in the future and rethrown by get()
+        template<typename T>
+        inline std::future<T> spawn(Task<T> task, ThreadPool& pool = ThreadPool::instance()) noexcept
+        {
+            std::promise<T> promise;
+            auto future = promise.get_future();
+            [](Task<T> task, std::promise<T> promise, ThreadPool& pool) -> async_detail::DetachedTask
+            {
+                co_await schedule(pool);
+                try
+                {
+                    if constexpr (std::is_void_v<T>)
+                    {
+                        co_await task;
+                        promise.set_value();
+                    }
+                    else
+                    {
+                        promise.set_value(co_await task);
+                    }
+                }
+                catch (...)
+                {
+                    promise.set_exception(std::current_exception());
+                }
+            }(std::move(task), std::move(promise), pool);
+            return future;
+        }
+
+        // run the task on the pool and block until it finishes, an exception thrown by the task is rethrown here
+        // called from a worker of the pool, the worker keeps running other jobs while waiting
+        template<typename T>
+        inline T sync_wait(Task<T> task, ThreadPool& pool = ThreadPool::instance())
+        {
+            auto future = spawn(std::move(task), pool);
+            return pool.wait(future);
+        }
+
+        // run the tasks concurrently on the pool and resume when all of them are finished
+        // if some of them throw, the exception of the first one in order is rethrown when the returned task is awaited
+        template<typename T>
+            requires (!std::is_void_v<T>)
+        inline Task<std::vector<T>> when_all(std::vector<Task<T>> tasks, ThreadPool& pool = ThreadPool::instance()) noexcept
+        {
+            async_detail::Latch latch{ tasks.size() };
+            std::vector<std::optional<T>> values(tasks.size());
+            std::vector<std::exception_ptr> exceptions(tasks.size());
+            for (usize i{ 0_uz }; i != tasks.size(); ++i)
+            {
+                [](Task<T> task, std::optional<T>& value, std::exception_ptr& exception, async_detail::Latch& latch, ThreadPool& pool) -> async_detail::DetachedTask
+                {
+                    co_await schedule(pool);
+                    try
+                    {
+                        value.emplace(co_await task);
+                    }
+                    catch (...)
+                    {
+                        exception = std::current_exception();
+                    }
+                    latch.arrive();
+                }(std::move(tasks[i]), values[i], exceptions[i], latch, pool);
+            }
+            co_await latch;
+
+            for (const auto& exception : exceptions)
+            {
+                if (exception)
+                {
+                    std::rethrow_exception(exception);
+                }
+            }
+            std::vector<T> ret;
+            ret.reserve(values.size());
+            for (auto& value : values)
+            {
+                ret.push_back(std::move(value).value());
+            }
+            co_return std::move(ret);
+        }
+
+        inline Task<void> when_all(std::vector<Task<void>> tasks, ThreadPool& pool = ThreadPool::instance()) noexcept
+        {
+            async_detail::Latch latch{ tasks.size() };
+            std::vector<std::exception_ptr> exceptions(tasks.size());
+            for (usize i{ 0_uz }; i != tasks.size(); ++i)
+            {
+                [](Task<void> task, std::exception_ptr& exception, async_detail::Latch& latch, ThreadPool& pool) -> async_detail::DetachedTask
+                {
+                    co_await schedule(pool);
+                    try
+                    {
+                        co_await task;
+                    }
+                    catch (...)
+                    {
+                        exception = std::current_exception();
+                    }
+                    latch.arrive();
+                }(std::move(tasks[i]), exceptions[i], latch, pool);
+            }
+            co_await latch;
+
+            for (const auto& exception : exceptions)
+            {
+                if (exception)
+                {
+                    std::rethrow_exception(exception);
+                }
+            }
+        }
+
+        // run the tasks concurrently and return the first failure after all of them are finished
+        template<ErrorType E>
+        inline Task<Try<E>> when_all(std::vector<Task<Try<E>>> tasks, ThreadPool& pool = ThreadPool::instance()) noexcept
+        {
+            auto rets = co_await when_all<Try<E>>(std::move(tasks), pool);
+            for (auto& ret : rets)
+            {
+                if (ret.is_failed())
+                {
+                    co_return std::move(ret).err();
+                }
+            }
+            co_return succeed;
+        }
+    };
+};
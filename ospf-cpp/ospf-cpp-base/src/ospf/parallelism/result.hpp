@@ -1,3 +1,127 @@
 #pragma once
 
-// todo
+#include <ospf/exception.hpp>
+#include <ospf/functional/result.hpp>
+#include <exception>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace ospf
+{
+    inline namespace parallelism
+    {
+        template<typename T = Succeed, ErrorType E = OSPFError>
+        using FutureResult = std::future<Result<T, E>>;
+
+        // errors that an exception can be reported as, keeping its code and message
+        template<typename E>
+        concept ExceptionReportableError = ErrorType<E> && std::constructible_from<OriginType<E>, OSPFErrCode, std::string>;
+
+        template<ExceptionReportableError E = OSPFError>
+        inline OriginType<E> exception_error(const std::exception_ptr& exception) noexcept
+        {
+            try
+            {
+                std::rethrow_exception(exception);
+            }
+            catch (const OSPFException& e)
+            {
+                if constexpr (std::is_same_v<OriginType<E>, OSPFError>)
+                {
+                    return e.error();
+                }
+                else
+                {
+                    return OriginType<E>{ e.code(), std::string{ e.message() } };
+                }
+            }
+            catch (const std::exception& e)
+            {
+                return OriginType<E>{ OSPFErrCode::ApplicationException, std::string{ e.what() } };
+            }
+            catch (...)
+            {
+                return OriginType<E>{ OSPFErrCode::ApplicationException, std::string{ "unknown exception" } };
+            }
+        }
+
+        // waits for the result, an exception thrown by the task is reported as an error if the error type can carry it
+        template<typename T, ErrorType E>
+        inline Result<T, E> get_result(FutureResult<T, E>& future) noexcept(ExceptionReportableError<E>)
+        {
+            if constexpr (ExceptionReportableError<E>)
+            {
+                try
+                {
+                    return future.get();
+                }
+                catch (...)
+                {
+                    return exception_error<E>(std::current_exception());
+                }
+            }
+            else
+            {
+                return future.get();
+            }
+        }
+
+        template<ErrorType E>
+        inline Try<E> join(std::vector<FutureResult<Succeed, E>>& futures) noexcept(ExceptionReportableError<E>)
+        {
+            std::optional<OriginType<E>> err;
+            for (auto& future : futures)
+            {
+                auto ret = get_result(future);
+                if (ret.is_failed() && !err.has_value())
+                {
+                    err = std::move(ret).err();
+                }
+            }
+            futures.clear();
+            if (err.has_value())
+            {
+                return std::move(err).value();
+            }
+            else
+            {
+                return succeed;
+            }
+        }
+
+        template<typename T, ErrorType E>
+            requires (!std::is_same_v<T, Succeed>)
+        inline Result<std::vector<T>, E> join(std::vector<FutureResult<T, E>>& futures) noexcept(ExceptionReportableError<E>)
+        {
+            std::vector<T> values;
+            values.reserve(futures.size());
+            std::optional<OriginType<E>> err;
+            for (auto& future : futures)
+            {
+                auto ret = get_result(future);
+                if (err.has_value())
+                {
+                    continue;
+                }
+                if (ret.is_failed())
+                {
+                    err = std::move(ret).err();
+                }
+                else
+                {
+                    values.push_back(std::move(ret).unwrap());
+                }
+            }
+            futures.clear();
+            if (err.has_value())
+            {
+                return std::move(err).value();
+            }
+            else
+            {
+                return std::move(values);
+            }
+        }
+    };
+};
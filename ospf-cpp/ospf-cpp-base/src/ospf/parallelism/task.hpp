@@ -1,3 +1,230 @@
 ﻿#pragma once
 
-// todo
+#include <ospf/functional/result.hpp>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace ospf
+{
+    inline namespace parallelism
+    {
+        template<typename T = void>
+        class Task;
+
+        namespace task_detail
+        {
+            template<typename T>
+            class PromiseBase
+            {
+            public:
+                struct FinalAwaiter
+                {
+                    inline constexpr const bool await_ready(void) const noexcept
+                    {
+                        return false;
+                    }
+
+                    template<typename P>
+                    inline std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept
+                    {
+                        auto continuation = handle.promise()._continuation;
+                        if (continuation)
+                        {
+                            return continuation;
+                        }
+                        else
+                        {
+                            return std::noop_coroutine();
+                        }
+                    }
+
+                    inline constexpr void await_resume(void) const noexcept {}
+                };
+
+            public:
+                inline constexpr std::suspend_always initial_suspend(void) const noexcept
+                {
+                    return {};
+                }
+
+                inline constexpr FinalAwaiter final_suspend(void) const noexcept
+                {
+                    return {};
+                }
+
+                inline void unhandled_exception(void) noexcept
+                {
+                    _exception = std::current_exception();
+                }
+
+            public:
+                inline void set_continuation(const std::coroutine_handle<> continuation) noexcept
+                {
+                    _continuation = continuation;
+                }
+
+            protected:
+                inline void rethrow_if_failed(void) const
+                {
+                    if (_exception)
+                    {
+                        std::rethrow_exception(_exception);
+                    }
+                }
+
+            private:
+                std::coroutine_handle<> _continuation;
+                std::exception_ptr _exception;
+            };
+
+            template<typename T>
+            class Promise
+                : public PromiseBase<T>
+            {
+            public:
+                inline Task<T> get_return_object(void) noexcept;
+
+                template<typename U>
+                    requires std::convertible_to<U, T>
+                inline void return_value(U&& value) noexcept(std::is_nothrow_constructible_v<T, U>)
+                {
+                    _value.emplace(std::forward<U>(value));
+                }
+
+                inline T result(void) &&
+                {
+                    this->rethrow_if_failed();
+                    return std::move(_value).value();
+                }
+
+            private:
+                std::optional<T> _value;
+            };
+
+            template<>
+            class Promise<void>
+                : public PromiseBase<void>
+            {
+            public:
+                inline Task<void> get_return_object(void) noexcept;
+
+                inline constexpr void return_void(void) const noexcept {}
+
+                inline void result(void) &&
+                {
+                    this->rethrow_if_failed();
+                }
+            };
+        };
+
+        // lazily started coroutine, it runs when it is co_awaited and resumes its awaiter when it finishes
+        // errors are expected to be carried by Result<T> / Try<> as value, use OSPF_CO_TRY_* to propagate them
+        template<typename T>
+        class [[nodiscard]] Task
+        {
+        public:
+            using ValueType = T;
+            using promise_type = task_detail::Promise<T>;
+            using HandleType = std::coroutine_handle<promise_type>;
+
+        public:
+            Task(void) noexcept = default;
+            explicit Task(const HandleType handle) noexcept
+                : _handle(handle) {}
+            Task(const Task& ano) = delete;
+            Task(Task&& ano) noexcept
+                : _handle(std::exchange(ano._handle, nullptr)) {}
+            Task& operator=(const Task& rhs) = delete;
+            Task& operator=(Task&& rhs) noexcept
+            {
+                if (this != &rhs)
+                {
+                    destroy();
+                    _handle = std::exchange(rhs._handle, nullptr);
+                }
+                return *this;
+            }
+
+            ~Task(void) noexcept
+            {
+                destroy();
+            }
+
+        public:
+            inline const bool valid(void) const noexcept
+            {
+                return static_cast<bool>(_handle);
+            }
+
+            inline const bool done(void) const noexcept
+            {
+                return !_handle || _handle.done();
+            }
+
+        public:
+            inline const bool await_ready(void) const noexcept
+            {
+                return done();
+            }
+
+            inline std::coroutine_handle<> await_suspend(const std::coroutine_handle<> awaiting) noexcept
+            {
+                _handle.promise().set_continuation(awaiting);
+                return _handle;
+            }
+
+            inline T await_resume(void)
+            {
+                return std::move(_handle.promise()).result();
+            }
+
+        private:
+            inline void destroy(void) noexcept
+            {
+                if (_handle)
+                {
+                    _handle.destroy();
+                    _handle = nullptr;
+                }
+            }
+
+        private:
+            HandleType _handle;
+        };
+
+        namespace task_detail
+        {
+            template<typename T>
+            inline Task<T> Promise<T>::get_return_object(void) noexcept
+            {
+                return Task<T>{ std::coroutine_handle<Promise<T>>::from_promise(*this) };
+            }
+
+            inline Task<void> Promise<void>::get_return_object(void) noexcept
+            {
+                return Task<void>{ std::coroutine_handle<Promise<void>>::from_promise(*this) };
+            }
+        };
+    };
+};
+
+#ifndef OSPF_CO_TRY_EXEC
+#define OSPF_CO_TRY_EXEC(Func) {\
+    auto ret = Func;\
+    if (ret.is_failed())\
+    {\
+        co_return std::move(ret).err();\
+    }\
+}
+#endif
+
+#ifndef OSPF_CO_TRY_GET
+#define OSPF_CO_TRY_GET(Ret, Func) auto Ret##_ret = Func;\
+if (Ret##_ret.is_failed())\
+{\
+    co_return std::move(Ret##_ret).err();\
+}\
+auto Ret = std::move(Ret##_ret).unwrap();
+#endif
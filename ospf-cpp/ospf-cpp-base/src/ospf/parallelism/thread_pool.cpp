@@ -0,0 +1,207 @@
+﻿#include <ospf/parallelism/thread_pool.hpp>
+
+namespace ospf::parallelism
+{
+    namespace
+    {
+        struct WorkerInfo
+        {
+            const ThreadPool* pool = nullptr;
+            usize index = npos;
+        };
+
+        thread_local WorkerInfo this_worker{};
+    };
+
+    ThreadPool& ThreadPool::instance(void) noexcept
+    {
+        static ThreadPool _instance{};
+        return _instance;
+    }
+
+    ThreadPool::ThreadPool(const usize worker_amount)
+        : _stopped(false), _queued(0_uz), _pending(0_uz), _idle(0_uz), _waiting(0_uz)
+    {
+        const auto amount = (std::max)(worker_amount, 1_uz);
+        _queues.reserve(amount);
+        for (usize i{ 0_uz }; i != amount; ++i)
+        {
+            _queues.push_back(make_unique<JobQueue>());
+        }
+        _threads.reserve(amount);
+        for (usize i{ 0_uz }; i != amount; ++i)
+        {
+            _threads.emplace_back([this, i]()
+                {
+                    this->work(i);
+                });
+        }
+    }
+
+    ThreadPool::~ThreadPool(void) noexcept
+    {
+        {
+            std::lock_guard<std::mutex> guard{ _mutex };
+            _stopped = true;
+        }
+        _job_condition.notify_all();
+        // guard threads join here, before the queues are released
+        _threads.clear();
+    }
+
+    const bool ThreadPool::in_worker_thread(void) const noexcept
+    {
+        return this_worker.pool == this;
+    }
+
+    void ThreadPool::wait_all(void) noexcept
+    {
+        while (_pending.load() != 0_uz)
+        {
+            if (run_one())
+            {
+                continue;
+            }
+            std::unique_lock<std::mutex> lck{ _mutex };
+            _finished_condition.wait_for(lck, std::chrono::milliseconds{ 1 }, [this]()
+                {
+                    return this->_pending.load() == 0_uz || this->_queued.load() != 0_uz;
+                });
+        }
+    }
+
+    void ThreadPool::push(Unique<Job> job) noexcept
+    {
+        ++_pending;
+        ++_queued;
+        if (in_worker_thread())
+        {
+            auto& queue = *_queues[this_worker.index];
+            std::lock_guard<std::mutex> guard{ queue.mutex };
+            queue.jobs.push_back(std::move(job));
+        }
+        else
+        {
+            std::lock_guard<std::mutex> guard{ _injection_queue.mutex };
+            _injection_queue.jobs.push_back(std::move(job));
+        }
+        if (_idle.load() != 0_uz)
+        {
+            // take the lock so that a worker between its check and its wait cannot miss the notification
+            std::lock_guard<std::mutex> guard{ _mutex };
+            _job_condition.notify_one();
+        }
+    }
+
+    std::optional<Unique<ThreadPool::Job>> ThreadPool::pop(const usize index) noexcept
+    {
+        auto take = [this](JobQueue& queue, const bool back) -> std::optional<Unique<Job>>
+        {
+            std::lock_guard<std::mutex> guard{ queue.mutex };
+            if (queue.jobs.empty())
+            {
+                return std::nullopt;
+            }
+            Unique<Job> job = back ? std::move(queue.jobs.back()) : std::move(queue.jobs.front());
+            if (back)
+            {
+                queue.jobs.pop_back();
+            }
+            else
+            {
+                queue.jobs.pop_front();
+            }
+            --this->_queued;
+            return std::optional<Unique<Job>>{ std::move(job) };
+        };
+
+        if (index != npos)
+        {
+            if (auto job = take(*_queues[index], true))
+            {
+                return job;
+            }
+        }
+        if (auto job = take(_injection_queue, false))
+        {
+            return job;
+        }
+        const auto amount = _queues.size();
+        const auto bg = index != npos ? index + 1_uz : 0_uz;
+        for (usize i{ 0_uz }; i != amount; ++i)
+        {
+            const auto victim = (bg + i) % amount;
+            if (victim == index)
+            {
+                continue;
+            }
+            if (auto job = take(*_queues[victim], false))
+            {
+                return job;
+            }
+        }
+        return std::nullopt;
+    }
+
+    const bool ThreadPool::run_one(void) noexcept
+    {
+        if (_queued.load() == 0_uz)
+        {
+            return false;
+        }
+        auto job = pop(in_worker_thread() ? this_worker.index : npos);
+        if (!job.has_value())
+        {
+            return false;
+        }
+        (**job)();
+        finish();
+        return true;
+    }
+
+    void ThreadPool::finish(void) noexcept
+    {
+        const bool finished = --_pending == 0_uz;
+        const bool waited = _waiting.load() != 0_uz;
+        if (finished || waited)
+        {
+            std::lock_guard<std::mutex> guard{ _mutex };
+            if (finished)
+            {
+                _finished_condition.notify_all();
+            }
+            if (waited)
+            {
+                // the job may have fulfilled the future a worker waits for
+                _job_condition.notify_all();
+            }
+        }
+    }
+
+    void ThreadPool::work(const usize index) noexcept
+    {
+        this_worker = WorkerInfo{ this, index };
+        while (true)
+        {
+            if (auto job = pop(index))
+            {
+                (**job)();
+                finish();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lck{ _mutex };
+            ++_idle;
+            _job_condition.wait(lck, [this]()
+                {
+                    return this->_stopped.load() || this->_queued.load() != 0_uz;
+                });
+            --_idle;
+            if (_stopped.load() && _queued.load() == 0_uz)
+            {
+                break;
+            }
+        }
+        this_worker = WorkerInfo{};
+    }
+};
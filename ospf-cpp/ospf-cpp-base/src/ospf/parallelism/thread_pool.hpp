@@ -1,3 +1,260 @@
 ﻿#pragma once
 
-// todo
+#include <ospf/ospf_base_api.hpp>
+#include <ospf/exception.hpp>
+#include <ospf/literal_constant.hpp>
+#include <ospf/memory/pointer.hpp>
+#include <ospf/parallelism/guard_thread.hpp>
+#include <ospf/parallelism/result.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace ospf
+{
+    inline namespace parallelism
+    {
+        namespace thread_pool_detail
+        {
+            // jobs returning a Result report their exceptions as errors if its error type can carry them, so that waiting for them never throws
+            template<typename T>
+            struct ReportsException
+                : public std::false_type {};
+
+            template<typename T, ExceptionReportableError E>
+            struct ReportsException<Result<T, E>>
+                : public std::true_type {};
+        };
+
+        // fixed-size work-stealing pool
+        // every worker owns a deque: it pops its own jobs from the back and steals from the front of others,
+        // jobs submitted from outside the pool go into a shared injection queue,
+        // idle workers park on a condition variable until a job is queued
+        class ThreadPool
+        {
+        private:
+            class Job
+            {
+            public:
+                virtual ~Job(void) noexcept = default;
+                virtual void operator()(void) noexcept = 0;
+            };
+
+            template<typename F>
+            class JobImpl
+                : public Job
+            {
+            public:
+                using ResultType = std::invoke_result_t<F>;
+
+            public:
+                JobImpl(F func, std::promise<ResultType> promise)
+                    : _func(std::move(func)), _promise(std::move(promise)) {}
+                JobImpl(const JobImpl& ano) = delete;
+                JobImpl(JobImpl&& ano) noexcept = default;
+                JobImpl& operator=(const JobImpl& rhs) = delete;
+                JobImpl& operator=(JobImpl&& rhs) noexcept = default;
+                ~JobImpl(void) noexcept override = default;
+
+            public:
+                inline void operator()(void) noexcept override
+                {
+                    try
+                    {
+                        if constexpr (std::is_void_v<ResultType>)
+                        {
+                            _func();
+                            _promise.set_value();
+                        }
+                        else
+                        {
+                            _promise.set_value(_func());
+                        }
+                    }
+                    catch (...)
+                    {
+                        if constexpr (thread_pool_detail::ReportsException<ResultType>::value)
+                        {
+                            _promise.set_value(exception_error<typename ResultType::ErrType>(std::current_exception()));
+                        }
+                        else
+                        {
+                            _promise.set_exception(std::current_exception());
+                        }
+                    }
+                }
+
+            private:
+                F _func;
+                std::promise<ResultType> _promise;
+            };
+
+            struct JobQueue
+            {
+                std::mutex mutex;
+                std::deque<Unique<Job>> jobs;
+            };
+
+        public:
+            // shared executor of the library, sized by hardware concurrency
+            OSPF_BASE_API static ThreadPool& instance(void) noexcept;
+
+        public:
+            OSPF_BASE_API ThreadPool(const usize worker_amount = std::thread::hardware_concurrency());
+            ThreadPool(const ThreadPool& ano) = delete;
+            ThreadPool(ThreadPool&& ano) = delete;
+            ThreadPool& operator=(const ThreadPool& rhs) = delete;
+            ThreadPool& operator=(ThreadPool&& rhs) = delete;
+            OSPF_BASE_API ~ThreadPool(void) noexcept;
+
+        public:
+            inline const usize worker_amount(void) const noexcept
+            {
+                return _queues.size();
+            }
+
+            // whether the calling thread is one of the workers of this pool
+            OSPF_BASE_API const bool in_worker_thread(void) const noexcept;
+
+        public:
+            template<typename F>
+                requires std::invocable<F>
+            inline std::future<std::invoke_result_t<F>> submit(F&& func) noexcept
+            {
+                using FuncType = std::decay_t<F>;
+                using ResultType = std::invoke_result_t<F>;
+
+                std::promise<ResultType> promise;
+                auto future = promise.get_future();
+                push(make_base_unique<Job, JobImpl<FuncType>>(FuncType{ std::forward<F>(func) }, std::move(promise)));
+                return future;
+            }
+
+            // split [bg, ed) into chunks of grain_size indexes and run them on the pool
+            // func can return void or Try<>, the first failure is returned after all chunks are finished
+            template<typename F>
+                requires std::invocable<F, const usize>
+            inline Try<> parallel_for(const usize bg, const usize ed, F&& func, const usize grain_size = 0_uz) noexcept
+            {
+                if (bg >= ed)
+                {
+                    return succeed;
+                }
+
+                const auto amount = ed - bg;
+                const auto grain = grain_size != 0_uz ? grain_size : (std::max)(1_uz, amount / (worker_amount() * 4_uz));
+                if (grain >= amount)
+                {
+                    return run_range(func, bg, ed);
+                }
+
+                std::vector<FutureResult<>> futures;
+                futures.reserve((amount + grain - 1_uz) / grain);
+                for (usize i{ bg }; i < ed; i += grain)
+                {
+                    const auto this_ed = (std::min)(i + grain, ed);
+                    futures.push_back(submit([&func, i, this_ed]() -> Try<>
+                        {
+                            return run_range(func, i, this_ed);
+                        }));
+                }
+                return join(futures);
+            }
+
+            // wait for the future, running queued jobs on the calling thread meanwhile if it is a worker of this pool,
+            // so that jobs waiting for other jobs never exhaust the workers
+            // the exception of a job is rethrown here unless its result is a Result, which carries it as an error
+            template<typename T>
+            inline T wait(std::future<T>& future)
+            {
+                help(future);
+                return future.get();
+            }
+
+            template<typename T, ErrorType E>
+            inline decltype(auto) join(std::vector<FutureResult<T, E>>& futures) noexcept
+            {
+                for (auto& future : futures)
+                {
+                    help(future);
+                }
+                return parallelism::join(futures);
+            }
+
+            // block until every submitted job is finished
+            OSPF_BASE_API void wait_all(void) noexcept;
+
+        private:
+            // on a worker, runs queued jobs until the future is ready, and parks on the job condition when there is none,
+            // so that it is woken by a new job or by the job fulfilling the future
+            template<typename T>
+            inline void help(std::future<T>& future) noexcept
+            {
+                if (!in_worker_thread())
+                {
+                    return;
+                }
+                while (future.wait_for(std::chrono::seconds{ 0 }) != std::future_status::ready)
+                {
+                    if (run_one())
+                    {
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lck{ _mutex };
+                    ++_idle;
+                    ++_waiting;
+                    _job_condition.wait(lck, [this, &future]()
+                        {
+                            return this->_queued.load() != 0_uz || future.wait_for(std::chrono::seconds{ 0 }) == std::future_status::ready;
+                        });
+                    --_waiting;
+                    --_idle;
+                }
+            }
+
+            template<typename F>
+            inline static Try<> run_range(F& func, const usize bg, const usize ed) noexcept
+            {
+                try
+                {
+                    for (usize i{ bg }; i != ed; ++i)
+                    {
+                        if constexpr (std::is_void_v<std::invoke_result_t<F, const usize>>)
+                        {
+                            func(i);
+                        }
+                        else
+                        {
+                            OSPF_TRY_EXEC(func(i));
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    return exception_error(std::current_exception());
+                }
+                return succeed;
+            }
+
+            OSPF_BASE_API void push(Unique<Job> job) noexcept;
+            OSPF_BASE_API std::optional<Unique<Job>> pop(const usize index) noexcept;
+            OSPF_BASE_API const bool run_one(void) noexcept;
+            OSPF_BASE_API void finish(void) noexcept;
+            OSPF_BASE_API void work(const usize index) noexcept;
+
+        private:
+            std::atomic<bool> _stopped;
+            std::atomic<usize> _queued;
+            std::atomic<usize> _pending;
+            std::atomic<usize> _idle;
+            std::atomic<usize> _waiting;
+            std::mutex _mutex;
+            std::condition_variable _job_condition;
+            std::condition_variable _finished_condition;
+            JobQueue _injection_queue;
+            std::vector<Unique<JobQueue>> _queues;
+            std::vector<GuardThread> _threads;
+        };
+    };
+};
@@ -5,3 +5,4 @@
 #include <ospf/serialization/bytes/to_value.hpp>
 #include <ospf/serialization/bytes/serializer.hpp>
 #include <ospf/serialization/bytes/deserializer.hpp>
+#include <ospf/serialization/bytes/mapped.hpp>
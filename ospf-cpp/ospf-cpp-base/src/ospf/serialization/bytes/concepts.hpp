@@ -2,6 +2,7 @@
 
 #include <ospf/concepts/base.hpp>
 #include <ospf/basic_definition.hpp>
+#include <ospf/literal_constant.hpp>
 #include <iterator>
 
 namespace ospf
@@ -21,6 +22,14 @@ namespace ospf
             concept ToValueIter = std::output_iterator<It, ubyte>;
 
             using NameTransfer = std::function<const std::string_view(const std::string_view)>;
+
+            // arrays of them are written and read as one block of bytes, see to_bytes_block / from_bytes_block
+            template<typename T>
+            concept BlockSerializable = std::is_arithmetic_v<T> && !std::same_as<T, bool>;
+
+            // amount of elements staged at a time for containers whose elements are not contiguous
+            template<typename T>
+            inline constexpr const usize block_buffer_size = (4_uz << 10_uz) / sizeof(T);
         };
     };
 };
@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include <ospf/bytes/mapped_file.hpp>
 #include <ospf/serialization/bytes/concepts.hpp>
 #include <ospf/serialization/bytes/from_value.hpp>
 #include <ospf/serialization/bytes/header.hpp>
@@ -7,6 +8,10 @@
 #include <fstream>
 #include <sstream>
 
+#ifdef OSPF_MULTI_THREAD
+#include <ospf/parallelism/thread_pool.hpp>
+#endif
+
 namespace ospf
 {
     inline namespace serialization
@@ -33,27 +38,16 @@ namespace ospf
             public:
                 template<usize len>
                 inline Result<Either<ValueType, std::vector<ValueType>>> operator()(const Bytes<len>& bytes) const noexcept
+                {
+                    return (*this)(BytesView<>{ bytes });
+                }
+
+                // decodes in place, e.g. from a memory mapped file, view types in ValueType point into the bytes
+                template<usize len>
+                inline Result<Either<ValueType, std::vector<ValueType>>> operator()(const BytesView<len> bytes) const noexcept
                 {
                     auto it = bytes.begin();
-                    OSPF_TRY_GET(header, deserialize_header(it));
-                    switch (header.root_tag())
-                    {
-                    case HeaderTag::Object:
-                    {
-                        OSPF_TRY_GET(obj, deserialize_object(header, it));
-                        return Either<ValueType, std::vector<ValueType>>::left(std::move(obj));
-                    }
-                    case HeaderTag::Array:
-                    {
-                        OSPF_TRY_GET(objs, deserialize_array(header, it));
-                        return Either<ValueType, std::vector<ValueType>>::right(std::move(objs));
-                    }
-                    case HeaderTag::Value:
-                        break;
-                    default:
-                        break;
-                    }
-                    return OSPFError{ OSPFErrCode::DeserializationFail, "invalid root tag \"{}\"", to_string(header.root_tag()) };
+                    return (*this)(it);
                 }
 
                 template<FromValueIter It>
@@ -83,17 +77,23 @@ namespace ospf
             public:
                 template<usize len>
                 inline Result<ValueType> parse_object(const Bytes<len>& bytes) const noexcept
+                {
+                    return parse_object(BytesView<>{ bytes });
+                }
+
+                template<usize len>
+                inline Result<ValueType> parse_object(const BytesView<len> bytes) const noexcept
                 {
                     auto it = bytes.begin();
-                    OSPF_TRY_GET(header, deserialize_header(it));
-                    if (header.root_tag() != HeaderTag::Object)
-                    {
-                        return OSPFError{ OSPFErrCode::DeserializationFail, std::format("invalid root tag \"{}\"", to_string(header.root_tag())) };
-                    }
-                    else
-                    {
-                        return deserialize_object(header, it);
-                    }
+                    return parse_object(it);
+                }
+
+                // misaligned arrays viewed in the bytes are copied into the storage
+                template<usize len>
+                inline Result<ValueType> parse_object(const BytesView<len> bytes, ViewStorage& storage) const noexcept
+                {
+                    auto it = storage.begin(bytes);
+                    return parse_object(it);
                 }
 
                 template<FromValueIter It>
@@ -112,17 +112,23 @@ namespace ospf
 
                 template<usize len>
                 inline Result<std::vector<ValueType>> parse_array(const Bytes<len>& bytes) const noexcept
+                {
+                    return parse_array(BytesView<>{ bytes });
+                }
+
+                template<usize len>
+                inline Result<std::vector<ValueType>> parse_array(const BytesView<len> bytes) const noexcept
                 {
                     auto it = bytes.begin();
-                    OSPF_TRY_GET(header, deserialize_header(it));
-                    if (header.root_tag() != HeaderTag::Array)
-                    {
-                        return OSPFError{ OSPFErrCode::DeserializationFail, std::format("invalid root tag \"{}\"", to_string(header.root_tag())) };
-                    }
-                    else
-                    {
-                        return deserialize_array(header, it);
-                    }
+                    return parse_array(it);
+                }
+
+                // misaligned arrays viewed in the bytes are copied into the storage
+                template<usize len>
+                inline Result<std::vector<ValueType>> parse_array(const BytesView<len> bytes, ViewStorage& storage) const noexcept
+                {
+                    auto it = storage.begin(bytes);
+                    return parse_array(it);
                 }
 
                 template<FromValueIter It>
@@ -157,28 +163,36 @@ namespace ospf
                 inline Result<ValueType> deserialize_object(const Header& header, It& it) const noexcept
                 {
                     assert(header.root_tag() == HeaderTag::Object);
-                    if constexpr (std::random_access_iterator<It>)
-                    {
 #ifdef OSPF_MULTI_THREAD
+                    if constexpr (std::random_access_iterator<It> && WithMetaInfo<ValueType> && WithDefault<ValueType>)
+                    {
+                        static const meta_info::MetaInfo<ValueType> info{};
                         ValueType obj = DefaultValue<ValueType>::value();
-                        std::vector<std::future<Try<>>> futures;
-                        for (usize i{ 0_uz }; i != header.segement_size(); ++i)
+                        usize field_amount{ 0_uz };
+                        info.for_each(obj, [&field_amount](const auto& obj, const auto& field)
+                            {
+                                ++field_amount;
+                            });
+                        if (segements_usable(header, field_amount, header.size()))
                         {
-                            const auto bg = header.field_segement()[i];
-                            const auto ed = (i != header.segement_size() - 1_uz) ? header.field_segement()[1 + 1_uz] : npos;
-                            const auto bg_offset = header.segement()[i];
-                            const auto ed_offset = (i != header.segement_size() - 1_uz) ? header.segement()[1 + 1_uz] : header.size();
-                            const auto bg_it = it + bg_offset;
-                            const auto ed_it = it + ed_offset;
-                            futures.push_back(std::async(std::launch::async, [&header, bg, ed, bg_it, ed_it, &obj](void) -> Try<>
+                            const auto field_segement = header.field_segement();
+                            const auto segement = header.segement();
+                            const auto bg_it = it;
+                            OSPF_TRY_EXEC(ThreadPool::instance().parallel_for(0_uz, header.segement_size(), [&header, &obj, field_amount, field_segement, segement, bg_it](const usize i) -> Try<>
                                 {
-                                    static const meta_info::MetaInfo<ValueType> info{};
+                                    const auto last = (i + 1_uz) == segement.size();
+                                    const auto bg = static_cast<usize>(field_segement[i]);
+                                    const auto ed = last ? field_amount : static_cast<usize>(field_segement[i + 1_uz]);
+                                    auto this_it = bg_it + segement[i];
+                                    const auto ed_it = bg_it + (last ? header.size() : segement[i + 1_uz]);
+
+                                    // every thread walks all the fields but only touches the ones of its own segement
                                     std::optional<OSPFError> err;
-                                    usize i{ 0_uz };
-                                    usize it = bg_it;
-                                    info.for_each(obj, [&header, bg, ed, &i, &it, ed_it, &err](auto& obj, const auto& field)
+                                    usize j{ 0_uz };
+                                    info.for_each(obj, [&header, bg, ed, &j, &this_it, &err](auto& obj, const auto& field)
                                         {
                                             using FieldValueType = OriginType<decltype(field.value(obj))>;
+                                            const auto index = j++;
                                             if constexpr (!field.writable() || !serialization_writable<FieldValueType>)
                                             {
                                                 return;
@@ -187,127 +201,140 @@ namespace ospf
                                             {
                                                 static_assert(DeserializableFromBytes<FieldValueType>);
 
-                                                if (err.has_value() || i == ed || it == ed_it)
+                                                if (err.has_value() || index < bg || index >= ed)
                                                 {
                                                     return;
                                                 }
 
-                                                if (i >= bg)
+                                                static const FromBytesValue<FieldValueType> deserializer{};
+                                                auto value = deserializer(this_it, header.address_length(), header.endian());
+                                                if constexpr (!serialization_nullable<FieldValueType>)
                                                 {
-                                                    static const FromBytesValue<FieldValueType> deserializer{};
-                                                    auto value = deserializer(it, header.address_length(), header.endian());
                                                     if (value.is_failed())
                                                     {
-                                                        err = std::move(value).err();
-                                                    }
-                                                    else
-                                                    {
-                                                        field.value(obj) = std::move(value).unwrap();
+                                                        err = OSPFError{ OSPFErrCode::DeserializationFail, std::format("failed deserializing field \"{}\" for type {}, {}", field.key(), TypeInfo<ValueType>::name(), value.err().message()) };
+                                                        return;
                                                     }
                                                 }
-                                                ++i;
+                                                if (value.is_succeeded())
+                                                {
+                                                    field.value(obj) = std::move(value).unwrap();
+                                                }
                                             }
                                         });
                                     if (err.has_value())
                                     {
                                         return std::move(err).value();
                                     }
+                                    else if (this_it != ed_it)
+                                    {
+                                        return OSPFError{ OSPFErrCode::DeserializationFail, std::format("segement {} does not end at its recorded offset", i) };
+                                    }
                                     else
                                     {
                                         return succeed;
                                     }
-                                }));
-                        }
-                        for (auto& future : futures)
-                        {
-                            OSPF_TRY_EXEC(future.get());
+                                }, 1_uz));
+                            it = bg_it + header.size();
+                            return std::move(obj);
                         }
-                        return std::move(obj);
-#else
-                        static const FromBytesValue<ValueType> deserializer{};
-                        return deserializer(it, header.address_length(), header.endian());
-#endif
-                    }
-                    else
-                    {
-                        static const FromBytesValue<ValueType> deserializer{};
-                        return deserializer(it, header.address_length(), header.endian());
                     }
+#endif
+                    static const FromBytesValue<ValueType> deserializer{};
+                    return deserializer(it, header.address_length(), header.endian());
                 }
 
                 template<FromValueIter It>
                 inline Result<std::vector<ValueType>> deserialize_array(const Header& header, It& it) const noexcept
                 {
                     assert(header.root_tag() == HeaderTag::Array);
-                    if constexpr (std::random_access_iterator<It>)
-                    {
 #ifdef OSPF_MULTI_THREAD
-                        std::vector<std::future<Result<std::vector<ValueType>>>> futures;
-                        for (usize i{ 0_uz }; i != header.segement_size(); ++i)
+                    if constexpr (std::random_access_iterator<It> && std::default_initializable<ValueType>)
+                    {
+                        auto bg_it = it;
+                        OSPF_TRY_GET(amount, get_size(bg_it, header.address_length(), header.endian()));
+                        if (header.size() >= header.address_length() && segements_usable(header, amount, header.size() - header.address_length()))
                         {
-                            const auto bg_it = it + header.segement()[i];
-                            const auto ed_it = it + ((i != header.segement_size() - 1_uz) ? header.segement()[i + 1_uz] : header.size());
-                            futures.push_back(std::async(std::launch::async, [&header, bg_it, ed_it](void) -> Result<std::vector<ValueType>>
+                            const auto field_segement = header.field_segement();
+                            const auto segement = header.segement();
+                            const auto payload = header.size() - header.address_length();
+                            std::vector<ValueType> ret(amount);
+                            OSPF_TRY_EXEC(ThreadPool::instance().parallel_for(0_uz, header.segement_size(), [&header, &ret, amount, payload, field_segement, segement, bg_it](const usize i) -> Try<>
                                 {
-                                    std::vector<ValueType> objs;
-                                    objs.reserve((ed_it - bg_it) / sizeof(ValueType));
-                                    for (auto it{ bg_it }; it != ed_it; )
+                                    const auto last = (i + 1_uz) == segement.size();
+                                    const auto bg = static_cast<usize>(field_segement[i]);
+                                    const auto ed = last ? amount : static_cast<usize>(field_segement[i + 1_uz]);
+                                    auto this_it = bg_it + segement[i];
+                                    const auto ed_it = bg_it + (last ? payload : segement[i + 1_uz]);
+                                    for (usize j{ bg }; j != ed; ++j)
                                     {
                                         static const FromBytesValue<ValueType> deserializer{};
-                                        OSPF_TRY_GET(obj, deserializer(it, header.address_length(), header.endian()));
-                                        objs.push_back(std::move(obj));
+                                        OSPF_TRY_GET(obj, deserializer(this_it, header.address_length(), header.endian()));
+                                        ret[j] = std::move(obj);
                                     }
-                                    objs.shrink_to_fit();
-                                    return std::move(objs);
-                                }));
-                        }
-                        std::vector<ValueType> ret;
-                        ret.reserve(header.size() / sizeof(ValueType));
-                        for (auto& future : futures)
-                        {
-                            OSPF_TRY_GET(objs, future.get());
-                            std::move(objs.begin(), objs.end(), std::back_inserter(ret));
+                                    if (this_it != ed_it)
+                                    {
+                                        return OSPFError{ OSPFErrCode::DeserializationFail, std::format("segement {} does not end at its recorded offset", i) };
+                                    }
+                                    return succeed;
+                                }, 1_uz));
+                            it = bg_it + payload;
+                            return std::move(ret);
                         }
-                        ret.shrink_to_fit();
-#else
-                        static const FromBytesValue<std::vector<ValueType>> deserializer{};
-                        return deserializer(it, header.address_length(), header.endian());
+                    }
 #endif
+                    static const FromBytesValue<std::vector<ValueType>> deserializer{};
+                    return deserializer(it, header.address_length(), header.endian());
+                }
+
+                // the segement table is usable if it starts from 0 and never goes backward or beyond the payload,
+                // field_segement()[i] is the index of the first field or element of segement i,
+                // segement()[i] is its offset in bytes from the first field or element,
+                // bytes without a usable table (e.g. single segement ones) are decoded sequentially
+                inline static const bool segements_usable(const Header& header, const usize amount, const u64 payload) noexcept
+                {
+                    const auto field_segement = header.field_segement();
+                    const auto segement = header.segement();
+                    if (segement.size() < 2_uz || field_segement.size() != segement.size() 
+                        || field_segement.front() != 0_u64 || segement.front() != 0_u64)
+                    {
+                        return false;
                     }
-                    else
+                    for (usize i{ 1_uz }; i != segement.size(); ++i)
                     {
-                        static const FromBytesValue<std::vector<ValueType>> deserializer{};
-                        return deserializer(it, header.address_length(), header.endian());
+                        if (field_segement[i] < field_segement[i - 1_uz] || segement[i] < segement[i - 1_uz])
+                        {
+                            return false;
+                        }
                     }
+                    return field_segement.back() <= static_cast<u64>(amount) && segement.back() <= payload;
                 }
 
             private:
                 std::optional<NameTransfer> _transfer;
             };
 
+            // the mapping is closed on return, so values containing views of the bytes are decoded with map_object / map_array instead
             template<typename T, CharType CharT = char>
-                requires DeserializableFromBytes<T>
+                requires DeserializableFromBytes<T> && (!views_bytes<T>)
             inline auto from_file(
                 const std::filesystem::path& path,
                 std::optional<NameTransfer> transfer = std::nullopt
             ) noexcept -> Result<Either<OriginType<T>, std::vector<OriginType<T>>>>
             {
-                if (!std::filesystem::exists(path))
-                {
-                    return OSPFError{ OSPFErrCode::FileNotFound, std::format("\"{}\" not exist", path.string()) };
-                }
-                if (std::filesystem::is_directory(path))
+                // decoded from the mapping directly, nothing is read into an intermediate buffer
+                OSPF_TRY_GET(file, MappedFile::open(path));
+                if (file.empty())
                 {
-                    return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" is not a file", path.string()) };
+                    return OSPFError{ OSPFErrCode::DataEmpty, std::format("\"{}\" is empty", path.string()) };
                 }
 
-                std::basic_ifstream<CharT> fin{ path };
                 auto deserializer = (transfer.has_value()) ? Deserializer<OriginType<T>>{ std::move(transfer).value() } : Deserializer<OriginType<T>>{};
-                return deserializer(fin);
+                return deserializer(file.view());
             }
 
             template<typename T, CharType CharT = char>
-                requires DeserializableFromBytes<T>
+                requires DeserializableFromBytes<T> && (!views_bytes<T>)
             inline auto from_file(
                 const std::filesystem::path& path,
                 NameTransfer transfer
@@ -317,28 +344,25 @@ namespace ospf
             }
 
             template<typename T, CharType CharT = char>
-                requires DeserializableFromBytes<T>
+                requires DeserializableFromBytes<T> && (!views_bytes<T>)
             inline Result<OriginType<T>> from_file_object(
                 const std::filesystem::path& path,
                 std::optional<NameTransfer> transfer = std::nullopt
             ) noexcept
             {
-                if (!std::filesystem::exists(path))
-                {
-                    return OSPFError{ OSPFErrCode::FileNotFound, std::format("\"{}\" not exist", path.string()) };
-                }
-                if (std::filesystem::is_directory(path))
+                // decoded from the mapping directly, nothing is read into an intermediate buffer
+                OSPF_TRY_GET(file, MappedFile::open(path));
+                if (file.empty())
                 {
-                    return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" is not a file", path.string()) };
+                    return OSPFError{ OSPFErrCode::DataEmpty, std::format("\"{}\" is empty", path.string()) };
                 }
 
-                std::basic_ifstream<CharT> fin{ path };
                 auto deserializer = (transfer.has_value()) ? Deserializer<OriginType<T>>{ std::move(transfer).value() } : Deserializer<OriginType<T>>{};
-                return deserializer.parse_object(fin);
+                return deserializer.parse_object(file.view());
             }
 
             template<typename T, CharType CharT = char>
-                requires DeserializableFromBytes<T>
+                requires DeserializableFromBytes<T> && (!views_bytes<T>)
             inline Result<OriginType<T>> from_file_object(
                 const std::filesystem::path& path,
                 NameTransfer transfer
@@ -348,28 +372,25 @@ namespace ospf
             }
 
             template<typename T, CharType CharT = char>
-                requires DeserializableFromBytes<T>
+                requires DeserializableFromBytes<T> && (!views_bytes<T>)
             inline Result<std::vector<OriginType<T>>> from_file_array(
                 const std::filesystem::path& path,
                 std::optional<NameTransfer> transfer = std::nullopt
             ) noexcept
             {
-                if (!std::filesystem::exists(path))
+                // decoded from the mapping directly, nothing is read into an intermediate buffer
+                OSPF_TRY_GET(file, MappedFile::open(path));
+                if (file.empty())
                 {
-                    return OSPFError{ OSPFErrCode::FileNotFound, std::format("\"{}\" not exist", path.string()) };
-                }
-                if (std::filesystem::is_directory(path))
-                {
-                    return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" is not a file", path.string()) };
+                    return OSPFError{ OSPFErrCode::DataEmpty, std::format("\"{}\" is empty", path.string()) };
                 }
 
-                std::basic_ifstream<CharT> fin{ path };
                 auto deserializer = (transfer.has_value()) ? Deserializer<OriginType<T>>{ std::move(transfer).value() } : Deserializer<OriginType<T>>{};
-                return deserializer.parse_array(fin);
+                return deserializer.parse_array(file.view());
             }
 
             template<typename T, CharType CharT = char>
-                requires DeserializableFromBytes<T>
+                requires DeserializableFromBytes<T> && (!views_bytes<T>)
             inline Result<std::vector<OriginType<T>>> from_file_array(
                 const std::filesystem::path& path,
                 NameTransfer transfer
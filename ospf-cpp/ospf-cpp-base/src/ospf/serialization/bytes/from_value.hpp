@@ -12,7 +12,19 @@
 #include <ospf/serialization/bytes/concepts.hpp>
 #include <ospf/serialization/writable.hpp>
 #include <ospf/serialization/nullable.hpp>
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <cstring>
 #include <deque>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <vector>
 
 namespace ospf
 {
@@ -306,11 +318,20 @@ namespace ospf
                     {
                         return OSPFError{ OSPFErrCode::DeserializationFail, std::format("invalid size \"{}\" for \"{}\"", size, TypeInfo<std::array<T, len>>::name()) };
                     }
-                    return make_array<T, len>([&it, address_length, endian](const usize _) -> Result<T>
-                        {
-                            static const FromBytesValue<OriginType<T>> deserializer{};
-                            return deserializer(it, address_length, endian);
-                        });
+                    if constexpr (BlockSerializable<T>)
+                    {
+                        std::array<T, len> objs{};
+                        from_bytes_block<T>(it, std::span<T>{ objs }, endian);
+                        return std::move(objs);
+                    }
+                    else
+                    {
+                        return make_array<T, len>([&it, address_length, endian](const usize _) -> Result<T>
+                            {
+                                static const FromBytesValue<OriginType<T>> deserializer{};
+                                return deserializer(it, address_length, endian);
+                            });
+                    }
                 }
             };
 
@@ -322,15 +343,24 @@ namespace ospf
                 inline Result<std::vector<T>> operator()(It& it, const usize address_length, const Endian endian) const noexcept
                 {
                     OSPF_TRY_GET(size, get_size(it, address_length, endian));
-                    std::vector<T> objs;
-                    objs.reserve(size);
-                    for (const auto _ : 0_uz RTo size)
+                    if constexpr (BlockSerializable<T>)
                     {
-                        static const FromBytesValue<OriginType<T>> deserializer{};
-                        OSPF_TRY_GET(obj, deserializer(it, address_length, endian));
-                        objs.push_back(std::move(obj));
+                        std::vector<T> objs(size);
+                        from_bytes_block<T>(it, std::span<T>{ objs }, endian);
+                        return std::move(objs);
+                    }
+                    else
+                    {
+                        std::vector<T> objs;
+                        objs.reserve(size);
+                        for (const auto _ : 0_uz RTo size)
+                        {
+                            static const FromBytesValue<OriginType<T>> deserializer{};
+                            OSPF_TRY_GET(obj, deserializer(it, address_length, endian));
+                            objs.push_back(std::move(obj));
+                        }
+                        return std::move(objs);
                     }
-                    return std::move(objs);
                 }
             };
 
@@ -343,11 +373,25 @@ namespace ospf
                 {
                     OSPF_TRY_GET(size, get_size(it, address_length, endian));
                     std::deque<T> objs;
-                    for (const auto _ : 0_uz RTo size)
+                    if constexpr (BlockSerializable<T>)
                     {
-                        static const FromBytesValue<OriginType<T>> deserializer{};
-                        OSPF_TRY_GET(obj, deserializer(it, address_length, endian));
-                        objs.push_back(std::move(obj));
+                        // staged through a buffer, the elements of a deque are only contiguous piecewise
+                        std::array<T, block_buffer_size<T>> buffer{};
+                        for (usize i{ 0_uz }; i < size; i += buffer.size())
+                        {
+                            const auto amount = (std::min)(buffer.size(), size - i);
+                            from_bytes_block<T>(it, std::span<T>{ buffer.data(), amount }, endian);
+                            objs.insert(objs.end(), buffer.cbegin(), buffer.cbegin() + amount);
+                        }
+                    }
+                    else
+                    {
+                        for (const auto _ : 0_uz RTo size)
+                        {
+                            static const FromBytesValue<OriginType<T>> deserializer{};
+                            OSPF_TRY_GET(obj, deserializer(it, address_length, endian));
+                            objs.push_back(std::move(obj));
+                        }
                     }
                     return std::move(objs);
                 }
@@ -640,6 +684,26 @@ namespace ospf
                 }
             };
 
+            template<>
+            struct FromBytesValue<f32>
+            {
+                template<FromValueIter It>
+                inline Result<f32> operator()(It& it, const usize address_length, const Endian endian) const noexcept
+                {
+                    return from_bytes<f32>(it, endian);
+                }
+            };
+
+            template<>
+            struct FromBytesValue<f64>
+            {
+                template<FromValueIter It>
+                inline Result<f64> operator()(It& it, const usize address_length, const Endian endian) const noexcept
+                {
+                    return from_bytes<f64>(it, endian);
+                }
+            };
+
             template<>
             struct FromBytesValue<std::string>
             {
@@ -647,7 +711,7 @@ namespace ospf
                 inline Result<std::string> operator()(It& it, const usize address_length, const Endian endian) const noexcept
                 {
                     OSPF_TRY_GET(size, get_size(it, address_length, endian));
-                    std::string str{ size, '\0' };
+                    std::string str(size, '\0');
                     for (usize i{ 0_uz }; i != size; ++i)
                     {
                         str[i] = static_cast<char>(from_bytes<ubyte>(it, endian));
@@ -655,6 +719,278 @@ namespace ospf
                     return std::move(str);
                 }
             };
+
+            // view decoding, the value points into the bytes and is only valid as long as them,
+            // it needs a contiguous iterator, e.g. the one of a memory mapped file or Bytes<>
+            template<>
+            struct FromBytesValue<std::string_view>
+            {
+                template<FromValueIter It>
+                    requires std::contiguous_iterator<It>
+                inline Result<std::string_view> operator()(It& it, const usize address_length, const Endian endian) const noexcept
+                {
+                    OSPF_TRY_GET(size, get_size(it, address_length, endian));
+                    const auto ptr = reinterpret_cast<const char*>(std::to_address(it));
+                    it += static_cast<std::iter_difference_t<It>>(size);
+                    return std::string_view{ ptr, size };
+                }
+            };
+
+            // copies of the misaligned arrays viewed by std::span<const T>, owned together with the bytes (see MappedValue),
+            // it is passed down with the iterator over the bytes, see ViewStorage::Iterator
+            class ViewStorage
+            {
+            public:
+                // contiguous iterator over the bytes decoded in place carrying their storage,
+                // the iterators of the segements decoded in other threads are got from it, so they carry the storage too
+                class Iterator
+                {
+                public:
+                    using iterator_concept = std::contiguous_iterator_tag;
+                    using iterator_category = std::random_access_iterator_tag;
+                    using value_type = ubyte;
+                    using element_type = const ubyte;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = const ubyte*;
+                    using reference = const ubyte&;
+
+                public:
+                    Iterator(void) = default;
+                    Iterator(const ubyte* const ptr, ViewStorage* const storage)
+                        : _ptr(ptr), _storage(storage) {}
+                    Iterator(const Iterator& ano) = default;
+                    Iterator(Iterator&& ano) noexcept = default;
+                    Iterator& operator=(const Iterator& rhs) = default;
+                    Iterator& operator=(Iterator&& rhs) noexcept = default;
+                    ~Iterator(void) noexcept = default;
+
+                public:
+                    inline ViewStorage* storage(void) const noexcept
+                    {
+                        return _storage;
+                    }
+
+                public:
+                    inline reference operator*(void) const noexcept
+                    {
+                        return *_ptr;
+                    }
+
+                    inline pointer operator->(void) const noexcept
+                    {
+                        return _ptr;
+                    }
+
+                    inline reference operator[](const difference_type n) const noexcept
+                    {
+                        return _ptr[n];
+                    }
+
+                    inline Iterator& operator++(void) noexcept
+                    {
+                        ++_ptr;
+                        return *this;
+                    }
+
+                    inline Iterator operator++(int) noexcept
+                    {
+                        auto ret = *this;
+                        ++_ptr;
+                        return ret;
+                    }
+
+                    inline Iterator& operator--(void) noexcept
+                    {
+                        --_ptr;
+                        return *this;
+                    }
+
+                    inline Iterator operator--(int) noexcept
+                    {
+                        auto ret = *this;
+                        --_ptr;
+                        return ret;
+                    }
+
+                    inline Iterator& operator+=(const difference_type n) noexcept
+                    {
+                        _ptr += n;
+                        return *this;
+                    }
+
+                    inline Iterator& operator-=(const difference_type n) noexcept
+                    {
+                        _ptr -= n;
+                        return *this;
+                    }
+
+                    inline Iterator operator+(const difference_type n) const noexcept
+                    {
+                        return Iterator{ _ptr + n, _storage };
+                    }
+
+                    inline Iterator operator-(const difference_type n) const noexcept
+                    {
+                        return Iterator{ _ptr - n, _storage };
+                    }
+
+                    inline difference_type operator-(const Iterator& rhs) const noexcept
+                    {
+                        return _ptr - rhs._ptr;
+                    }
+
+                    inline friend Iterator operator+(const difference_type n, const Iterator& it) noexcept
+                    {
+                        return it + n;
+                    }
+
+                public:
+                    inline const bool operator==(const Iterator& rhs) const noexcept
+                    {
+                        return _ptr == rhs._ptr;
+                    }
+
+                    inline std::strong_ordering operator<=>(const Iterator& rhs) const noexcept
+                    {
+                        return _ptr <=> rhs._ptr;
+                    }
+
+                private:
+                    const ubyte* _ptr{ nullptr };
+                    ViewStorage* _storage{ nullptr };
+                };
+
+            public:
+                ViewStorage(void) = default;
+                ViewStorage(const ViewStorage& ano) = delete;
+                ViewStorage(ViewStorage&& ano) = delete;
+                ViewStorage& operator=(const ViewStorage& rhs) = delete;
+                ViewStorage& operator=(ViewStorage&& rhs) = delete;
+                ~ViewStorage(void) noexcept = default;
+
+            public:
+                inline Iterator begin(const BytesView<> bytes) noexcept
+                {
+                    return Iterator{ bytes.data(), this };
+                }
+
+                // copy of the bytes, aligned for any arithmetic type,
+                // the segements decoded in parallel copy into the same storage
+                inline const ubyte* copy(const ubyte* const ptr, const usize size) noexcept
+                {
+                    auto block = std::make_unique<std::max_align_t[]>((size + sizeof(std::max_align_t) - 1_uz) / sizeof(std::max_align_t));
+                    std::memcpy(block.get(), ptr, size);
+                    std::lock_guard<std::mutex> guard{ _mutex };
+                    _blocks.push_back(std::move(block));
+                    return reinterpret_cast<const ubyte*>(_blocks.back().get());
+                }
+
+            private:
+                std::mutex _mutex;
+                std::vector<std::unique_ptr<std::max_align_t[]>> _blocks;
+            };
+
+            // view decoding of an array of block serializable values, written the same as std::vector<T>,
+            // the bytes need to be in local endian, or they should be decoded into std::vector<T> instead,
+            // a misaligned array is copied into the ViewStorage carried by the iterator, or fails if there is none
+            template<typename T>
+                requires BlockSerializable<T>
+            struct FromBytesValue<std::span<const T>>
+            {
+                template<FromValueIter It>
+                    requires std::contiguous_iterator<It>
+                inline Result<std::span<const T>> operator()(It& it, const usize address_length, const Endian endian) const noexcept
+                {
+                    OSPF_TRY_GET(size, get_size(it, address_length, endian));
+                    if (size == 0_uz)
+                    {
+                        return std::span<const T>{};
+                    }
+                    if constexpr (sizeof(T) != 1_uz)
+                    {
+                        if (endian != local_endian)
+                        {
+                            return OSPFError{ OSPFErrCode::DeserializationFail, std::format("cannot view \"{}\" in non-local endian", TypeInfo<T>::name()) };
+                        }
+                    }
+                    auto ptr = reinterpret_cast<const ubyte*>(std::to_address(it));
+                    if (reinterpret_cast<std::uintptr_t>(ptr) % alignof(T) != 0_uz)
+                    {
+                        ViewStorage* storage{ nullptr };
+                        if constexpr (DecaySameAs<It, ViewStorage::Iterator>)
+                        {
+                            storage = it.storage();
+                        }
+                        if (storage == nullptr)
+                        {
+                            return OSPFError{ OSPFErrCode::DeserializationFail, std::format("cannot view misaligned \"{}\" without a view storage", TypeInfo<T>::name()) };
+                        }
+                        ptr = storage->copy(ptr, size * sizeof(T));
+                    }
+                    it += static_cast<std::iter_difference_t<It>>(size * sizeof(T));
+                    return std::span<const T>{ reinterpret_cast<const T*>(ptr), size };
+                }
+            };
+
+            // whether a decoded T contains views pointing into the bytes, such a value is only valid as long as them
+            template<typename T>
+            struct ViewsBytes
+                : public std::false_type {};
+
+            template<typename T>
+            inline constexpr const bool views_bytes = ViewsBytes<OriginType<T>>::value;
+
+            template<>
+            struct ViewsBytes<std::string_view>
+                : public std::true_type {};
+
+            template<typename T>
+            struct ViewsBytes<std::span<const T>>
+                : public std::true_type {};
+
+            template<typename T>
+            struct ViewsBytes<std::optional<T>>
+                : public std::bool_constant<views_bytes<T>> {};
+
+            template<typename T, usize len>
+            struct ViewsBytes<std::array<T, len>>
+                : public std::bool_constant<views_bytes<T>> {};
+
+            template<typename T>
+            struct ViewsBytes<std::vector<T>>
+                : public std::bool_constant<views_bytes<T>> {};
+
+            template<typename T>
+            struct ViewsBytes<std::deque<T>>
+                : public std::bool_constant<views_bytes<T>> {};
+
+            template<typename T, typename U>
+            struct ViewsBytes<std::pair<T, U>>
+                : public std::bool_constant<views_bytes<T> || views_bytes<U>> {};
+
+            template<typename... Ts>
+            struct ViewsBytes<std::tuple<Ts...>>
+                : public std::bool_constant<(views_bytes<Ts> || ...)> {};
+
+            template<typename... Ts>
+            struct ViewsBytes<std::variant<Ts...>>
+                : public std::bool_constant<(views_bytes<Ts> || ...)> {};
+
+            template<WithMetaInfo T>
+            struct ViewsBytes<T>
+            {
+                static constexpr const bool value = []()
+                {
+                    constexpr const meta_info::MetaInfo<T> info{};
+                    bool ret{ false };
+                    info.for_each([&ret](const auto& field)
+                        {
+                            using FieldValueType = OriginType<decltype(field.value(std::declval<T>()))>;
+                            ret = ret || views_bytes<FieldValueType>;
+                        });
+                    return ret;
+                }();
+            };
         };
     };
 };
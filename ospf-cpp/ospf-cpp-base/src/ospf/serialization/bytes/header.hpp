@@ -3,6 +3,7 @@
 #include <ospf/serialization/bytes/from_value.hpp>
 #include <ospf/serialization/bytes/to_value.hpp>
 #include <ospf/string/hasher.hpp>
+#include <algorithm>
 #include <bit>
 
 namespace ospf
@@ -81,41 +82,54 @@ namespace ospf
             class Header
             {
             public:
-                static constexpr const usize local_segement_size = 4_uz;
+                // bytes per segement that serializers aim at, a segement is the unit of parallel encoding and decoding
+                static constexpr const usize default_segement_bytes = 1_uz << 20_uz;
+                static constexpr const usize max_segement_size = 1024_uz;
+
+                // amount of segements for a payload, one for small payloads and at most max_segement_size
+                // readers only trust the table itself, so bytes written with any other amount (e.g. the former fixed 4) still work
+                inline static constexpr const usize segement_size_of(const usize payload, const usize amount, const usize segement_bytes = default_segement_bytes) noexcept
+                {
+                    const auto bytes = (std::max)(segement_bytes, 1_uz);
+                    return (std::max)((std::min)({ (payload + bytes - 1_uz) / bytes, amount, max_segement_size }), 1_uz);
+                }
 
             public:
                 template<WithMetaInfo T>
-                inline static Header by(const T& obj, const std::optional<NameTransfer>& transfer, const Endian endian = local_endian) noexcept
+                inline static Header by(const T& obj, const std::optional<NameTransfer>& transfer, const Endian endian = local_endian, const usize segement_bytes = default_segement_bytes) noexcept
                 {
                     const auto root_tag = HeaderTag::Object;
 
+                    static const meta_info::MetaInfo<OriginType<T>> info{};
                     static const ToBytesValue<OriginType<T>> serializer{};
                     const usize size = serializer.size(obj);
+                    usize field_amount{ 0_uz };
+                    info.for_each(obj, [&field_amount](const auto& obj, const auto& field)
+                        {
+                            ++field_amount;
+                        });
 
-                    std::vector<u64> field_segement{ local_segement_size, 0_u64 };
-                    std::vector<u64> segement{ local_segement_size, 0_u64 };
+                    // segement j starts from the first field that begins behind j / amount of the payload
+                    const auto amount = segement_size_of(size, field_amount, segement_bytes);
+                    std::vector<u64> field_segement(1_uz, 0_u64);
+                    std::vector<u64> segement(1_uz, 0_u64);
+                    field_segement.reserve(amount);
+                    segement.reserve(amount);
                     {
-                        static const meta_info::MetaInfo<OriginType<T>> info{};
                         usize i{ 0_uz };
-                        usize j{ 1_uz };
                         usize current_size{ 0_uz };
-                        info.for_each(obj, [size, &field_segement, &segement, &i, &j, &current_size](const auto& obj, const auto& field)
+                        info.for_each(obj, [size, amount, &field_segement, &segement, &i, &current_size](const auto& obj, const auto& field)
                             {
                                 using FieldValueType = OriginType<decltype(field.value(obj))>;
-                        if (j == (local_segement_size - 1_uz))
-                        {
-                            return;
-                        }
-
-                        static const ToBytesValue<OriginType<T>> serializer{};
-                        current_size += serializer.size(field.value(obj));
-                        if (current_size >= (size * j / local_segement_size))
-                        {
-                            field_segement[j] = static_cast<u64>(i + 1_uz);
-                            segement[j] = static_cast<u64>(current_size);
-                            ++j;
-                        }
-                        ++i;
+                                if (field_segement.size() != amount && i != field_segement.back() && current_size >= (size * field_segement.size() / amount))
+                                {
+                                    field_segement.push_back(static_cast<u64>(i));
+                                    segement.push_back(static_cast<u64>(current_size));
+                                }
+
+                                static const ToBytesValue<FieldValueType> serializer{};
+                                current_size += serializer.size(field.value(obj));
+                                ++i;
                             });
                     }
 
@@ -124,27 +138,61 @@ namespace ospf
                 }
 
                 template<typename T, usize len>
-                inline static Header by(const std::span<const T, len> objs, const std::optional<NameTransfer>& transfer, const Endian endian = local_endian) noexcept
+                inline static Header by(const std::span<const T, len> objs, const std::optional<NameTransfer>& transfer, const Endian endian = local_endian, const usize segement_bytes = default_segement_bytes) noexcept
                 {
-                    const usize root_tag = HeaderTag::Array;
-
-                    static const ToBytesValue<std::span<ConstType<T>, len>> serializer{};
-                    const usize size = serializer.size(objs);
+                    const auto root_tag = HeaderTag::Array;
 
-                    std::vector<u64> segement{ local_segement_size, 0_u64 };
-                    for (usize i{ 0_uz }, j{ 1_uz }, current_size{ 0_uz }; i != objs.size(); ++i)
+                    static const ToBytesValue<OriginType<T>> serializer{};
+                    std::vector<u64> field_segement(1_uz, 0_u64);
+                    std::vector<u64> segement(1_uz, 0_u64);
+                    usize payload{ 0_uz };
+                    if constexpr (BlockSerializable<OriginType<T>>)
                     {
-                        static const ToBytesValue<OriginType<T>> serializer{};
-                        current_size += serializer.size();
-                        if (i >= (objs.size() * j / local_segement_size))
+                        // elements are of the same size, so segement j starts from the first element behind j / amount of the payload
+                        const usize element_size = serializer.size(OriginType<T>{});
+                        payload = objs.size() * element_size;
+                        const auto amount = segement_size_of(payload, objs.size(), segement_bytes);
+                        field_segement.reserve(amount);
+                        segement.reserve(amount);
+                        for (usize j{ 1_uz }; j != amount; ++j)
                         {
-                            segement[j] = static_cast<u64>(current_size);
-                            ++j;
+                            const auto i = (std::max)((payload * j / amount + element_size - 1_uz) / element_size, static_cast<usize>(field_segement.back()) + 1_uz);
+                            if (i >= objs.size())
+                            {
+                                break;
+                            }
+                            field_segement.push_back(static_cast<u64>(i));
+                            segement.push_back(static_cast<u64>(i * element_size));
                         }
                     }
+                    else
+                    {
+                        // segement j starts from the first element that begins behind j / amount of the payload
+                        std::vector<usize> sizes;
+                        sizes.reserve(objs.size());
+                        for (const auto& obj : objs)
+                        {
+                            sizes.push_back(serializer.size(obj));
+                            payload += sizes.back();
+                        }
+                        const auto amount = segement_size_of(payload, objs.size(), segement_bytes);
+                        field_segement.reserve(amount);
+                        segement.reserve(amount);
+                        for (usize i{ 0_uz }, current_size{ 0_uz }; i != objs.size(); ++i)
+                        {
+                            if (field_segement.size() != amount && i != field_segement.back() && current_size >= (payload * field_segement.size() / amount))
+                            {
+                                field_segement.push_back(static_cast<u64>(i));
+                                segement.push_back(static_cast<u64>(current_size));
+                            }
+                            current_size += sizes[i];
+                        }
+                    }
+                    // the amount of elements is written in front of them
+                    const usize size = ospf::address_length + payload;
 
                     auto [sub_headers, fields] = analysis<OriginType<T>>(transfer);
-                    return Header{ root_tag, ospf::address_length, endian, size, { local_segement_size, 0_u64 }, std::move(segement), std::move(sub_headers), std::move(fields) };
+                    return Header{ root_tag, ospf::address_length, endian, size, std::move(field_segement), std::move(segement), std::move(sub_headers), std::move(fields) };
                 }
 
             public:
@@ -163,6 +211,7 @@ namespace ospf
                     _endian(endian), _size(size),
                     _field_segement(std::move(field_segement)),
                     _segement(std::move(segement)),
+                    _sub_headers(std::move(sub_headers)),
                     _fields(std::move(fields))
                 {
                     assert(_field_segement.size() == _segement.size());
@@ -346,15 +395,15 @@ namespace ospf
             };
 
             template<typename T>
-            inline Header make_header(const T& obj, const std::optional<NameTransfer>& transfer, const Endian endian = local_endian) noexcept
+            inline Header make_header(const T& obj, const std::optional<NameTransfer>& transfer, const Endian endian = local_endian, const usize segement_bytes = Header::default_segement_bytes) noexcept
             {
-                return Header::by(obj, transfer, endian);
+                return Header::by(obj, transfer, endian, segement_bytes);
             }
 
             template<typename T, usize len>
-            inline Header make_header(const std::span<const T, len> objs, const std::optional<NameTransfer>& transfer, const Endian endian = local_endian) noexcept
+            inline Header make_header(const std::span<const T, len> objs, const std::optional<NameTransfer>& transfer, const Endian endian = local_endian, const usize segement_bytes = Header::default_segement_bytes) noexcept
             {
-                return Header::by(objs, transfer, endian);
+                return Header::by(objs, transfer, endian, segement_bytes);
             }
 
             template<>
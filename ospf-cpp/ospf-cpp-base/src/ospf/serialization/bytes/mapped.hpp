@@ -0,0 +1,120 @@
+﻿#pragma once
+
+#include <ospf/bytes/mapped_file.hpp>
+#include <ospf/functional/result.hpp>
+#include <ospf/serialization/bytes/deserializer.hpp>
+#include <filesystem>
+
+namespace ospf
+{
+    inline namespace serialization
+    {
+        namespace bytes
+        {
+            // value decoded in place from a memory mapped file,
+            // std::string_view and std::span<const T> in it point into the mapping instead of being copied out,
+            // except misaligned arrays, which are copied into a view storage kept with the mapping,
+            // the mapping is kept alive as long as the value, moving the value keeps its views valid
+            template<typename T>
+            class MappedValue
+            {
+            public:
+                using ValueType = T;
+
+            public:
+                MappedValue(MappedFile file, Unique<ViewStorage> storage, ValueType value)
+                    : _file(std::move(file)), _storage(std::move(storage)), _value(std::move(value)) {}
+                MappedValue(const MappedValue& ano) = delete;
+                MappedValue(MappedValue&& ano) noexcept = default;
+                MappedValue& operator=(const MappedValue& rhs) = delete;
+                MappedValue& operator=(MappedValue&& rhs) noexcept = default;
+                ~MappedValue(void) noexcept = default;
+
+            public:
+                inline const ValueType& value(void) const noexcept
+                {
+                    return _value;
+                }
+
+                inline const MappedFile& file(void) const noexcept
+                {
+                    return _file;
+                }
+
+                inline const ValueType& operator*(void) const noexcept
+                {
+                    return _value;
+                }
+
+                inline const ValueType* operator->(void) const noexcept
+                {
+                    return &_value;
+                }
+
+            private:
+                MappedFile _file;
+                Unique<ViewStorage> _storage;
+                ValueType _value;
+            };
+
+            template<typename T>
+                requires DeserializableFromBytes<T>
+            inline Result<MappedValue<OriginType<T>>> map_object(
+                const std::filesystem::path& path,
+                std::optional<NameTransfer> transfer = std::nullopt
+            ) noexcept
+            {
+                OSPF_TRY_GET(file, MappedFile::open(path));
+                if (file.empty())
+                {
+                    return OSPFError{ OSPFErrCode::DataEmpty, std::format("\"{}\" is empty", path.string()) };
+                }
+
+                // the storage stays in place when moved into the returned value, so the views copied into it stay valid
+                auto storage = make_unique<ViewStorage>();
+                auto deserializer = (transfer.has_value()) ? Deserializer<OriginType<T>>{ std::move(transfer).value() } : Deserializer<OriginType<T>>{};
+                OSPF_TRY_GET(obj, deserializer.parse_object(file.view(), *storage));
+                return MappedValue<OriginType<T>>{ std::move(file), std::move(storage), std::move(obj) };
+            }
+
+            template<typename T>
+                requires DeserializableFromBytes<T>
+            inline Result<MappedValue<OriginType<T>>> map_object(
+                const std::filesystem::path& path,
+                NameTransfer transfer
+            ) noexcept
+            {
+                return map_object<T>(path, std::optional<NameTransfer>{ std::move(transfer) });
+            }
+
+            template<typename T>
+                requires DeserializableFromBytes<T>
+            inline Result<MappedValue<std::vector<OriginType<T>>>> map_array(
+                const std::filesystem::path& path,
+                std::optional<NameTransfer> transfer = std::nullopt
+            ) noexcept
+            {
+                OSPF_TRY_GET(file, MappedFile::open(path));
+                if (file.empty())
+                {
+                    return OSPFError{ OSPFErrCode::DataEmpty, std::format("\"{}\" is empty", path.string()) };
+                }
+
+                auto storage = make_unique<ViewStorage>();
+                auto deserializer = (transfer.has_value()) ? Deserializer<OriginType<T>>{ std::move(transfer).value() } : Deserializer<OriginType<T>>{};
+                OSPF_TRY_GET(objs, deserializer.parse_array(file.view(), *storage));
+                return MappedValue<std::vector<OriginType<T>>>{ std::move(file), std::move(storage), std::move(objs) };
+            }
+
+            template<typename T>
+                requires DeserializableFromBytes<T>
+            inline Result<MappedValue<std::vector<OriginType<T>>>> map_array(
+                const std::filesystem::path& path,
+                NameTransfer transfer
+            ) noexcept
+            {
+                return map_array<T>(path, std::optional<NameTransfer>{ std::move(transfer) });
+            }
+        };
+    };
+};
@@ -9,7 +9,7 @@
 #include <iterator>
 
 #ifdef OSPF_MULTI_THREAD
-#include <future>
+#include <ospf/parallelism/thread_pool.hpp>
 #endif
 
 namespace ospf
@@ -36,41 +36,51 @@ namespace ospf
                 Serializer& operator=(Serializer&& rhs) noexcept = default;
                 ~Serializer(void) noexcept = default;
 
+            public:
+                // bytes per segement that the header is cut into, see Header::default_segement_bytes
+                inline const usize segement_bytes(void) const noexcept
+                {
+                    return _segement_bytes;
+                }
+
+                inline void set_segement_bytes(const usize segement_bytes) noexcept
+                {
+                    _segement_bytes = segement_bytes;
+                }
+
             public:
                 template<usize len>
                 inline Result<Bytes<>> operator()(const std::span<const ValueType, len> objs) const noexcept
                 {
                     Bytes<> ret;
-                    const auto header = make_header(objs, _transfer, _endian);
+                    const auto header = make_header(objs, _transfer, _endian, _segement_bytes);
                     static const ToBytesValue<Header> header_serializer{};
                     const auto header_size = header_serializer.size(header);
                     ret.resize(header_size + header.size(), 0_ub);
-                    header_serializer(header, ret.begin(), _endian);
-                    to_bytes<usize>(objs.size(), ret.begin() + header_size, _endian);
+                    auto it = ret.begin();
+                    OSPF_TRY_EXEC(header_serializer(header, it, _endian));
+                    to_bytes<usize>(objs.size(), it, _endian);
+                    static const ToBytesValue<ValueType> serializer{};
 #ifdef OSPF_MULTI_THREAD
-                    std::vector<std::future<Try<>>> futures;
-                    for (usize i{ 0_uz }; i != header.segement_size(); ++i)
-                    {
-                        const auto bg = header.field_segement()[i];
-                        const auto ed = (i != header.segement_size() - 1_uz) ? header.field_segement()[i + 1_uz] : objs.size();
-                        const auto offset = header.size() + address_length + header.segement()[i];
-                        futures.push_back(std::async(std::launch::async, [this, bg, ed, offset, &ret, &objs](void) -> Try<>
+                    const auto field_segement = header.field_segement();
+                    const auto segement = header.segement();
+                    const auto bg_it = it;
+                    OSPF_TRY_EXEC(ThreadPool::instance().parallel_for(0_uz, header.segement_size(), [this, objs, field_segement, segement, bg_it](const usize i) -> Try<>
+                        {
+                            const auto bg = static_cast<usize>(field_segement[i]);
+                            const auto ed = (i + 1_uz) != segement.size() ? static_cast<usize>(field_segement[i + 1_uz]) : objs.size();
+                            auto this_it = bg_it + segement[i];
+                            for (usize j{ bg }; j != ed; ++j)
                             {
-                                for (usize i{ bg }, this_offset{ offset }; i != ed; ++i)
-                                {
-                                    static const ToBytesValue<ValueType> serializer{};
-                                    serializer(objs[i], ret.begin() + this_offset, this->_endian);
-                                    this_offset += serializer.size(objs[i]);
-                                }
-                            }));
-                    }
-                    for (auto& future : futures)
+                                OSPF_TRY_EXEC(serializer(objs[j], this_it, this->_endian));
+                            }
+                            return succeed;
+                        }, 1_uz));
+#else
+                    for (const auto& obj : objs)
                     {
-                        OSPF_TRY_EXEC(future.get());
+                        OSPF_TRY_EXEC(serializer(obj, it, _endian));
                     }
-#else
-                    static const ToBytesValue<std::span<const ValueType, len>> serializer{};
-                    serializer(objs, ret.begin() + header_size, _endian);
 #endif
                     return std::move(ret);
                 }
@@ -78,7 +88,7 @@ namespace ospf
                 template<ToValueIter It, usize len>
                 inline Try<> operator()(const std::span<const ValueType, len> objs, It& it) const noexcept
                 {
-                    const auto header = make_header(objs, _transfer, _endian);
+                    const auto header = make_header(objs, _transfer, _endian, _segement_bytes);
                     static const ToBytesValue<Header> header_serializer{};
                     header_serializer(header, it, _endian);
                     static const ToBytesValue<std::span<const ValueType, len>> serializer{};
@@ -91,66 +101,55 @@ namespace ospf
                 inline Result<Bytes<>> operator()(const ValueType& obj) const noexcept
                 {
                     Bytes<> ret;
-                    const auto header = make_header(obj, _transfer, _endian);
+                    const auto header = make_header(obj, _transfer, _endian, _segement_bytes);
                     static const ToBytesValue<Header> header_serializer{};
                     const auto header_size = header_serializer.size(header);
                     ret.resize(header_size + header.size(), 0_ub);
+                    auto it = ret.begin();
+                    OSPF_TRY_EXEC(header_serializer(header, it, _endian));
 #ifdef OSPF_MULTI_THREAD
-                    std::vector<std::future<Try<>>> futures;
-                    for (usize i{ 0_uz }; i != header.segement_size(); ++i)
-                    {
-                        const auto bg = header.field_segement()[i];
-                        const auto ed = (i != header.segement_size() - 1_uz) ? header.field_segement()[i + 1_uz] : npos;
-                        const auto offset = header.size() + header.segement()[i];
-                        futures.push_back(std::async(std::launch::async, [this, bg, ed, offset, &ret](void) -> Try<>
-                            {
-                                static const meta_info::MetaInfo<ValueType> info{};
-                                std::optional<OSPFError> err;
-                                usize i{ 0_uz };
-                                usize this_offset{ offset };
-                                info.for_each(obj, [this, &i, ed, &this_offset, &ret, &err](const auto& obj, const auto& field)
-                                    {
-                                        using FieldValueType = OriginType<decltype(field.value(obj))>;
-                                        static_assert(SerializableToBytes<FieldValueType>);
-
-                                        if (err.has_value() || i == ed)
-                                        {
-                                            return;
-                                        }
+                    const auto field_segement = header.field_segement();
+                    const auto segement = header.segement();
+                    const auto bg_it = it;
+                    OSPF_TRY_EXEC(ThreadPool::instance().parallel_for(0_uz, header.segement_size(), [this, &obj, field_segement, segement, bg_it](const usize i) -> Try<>
+                        {
+                            const auto bg = static_cast<usize>(field_segement[i]);
+                            const auto ed = (i + 1_uz) != segement.size() ? static_cast<usize>(field_segement[i + 1_uz]) : npos;
+                            auto this_it = bg_it + segement[i];
 
-                                        if (i >= bg)
-                                        {
-                                            static const ToBytesValue<FieldValueType> serializer{};
-                                            const auto& value = field.value(obj);
-                                            const auto ret = serializer(value, ret.begin() + this_offset, this->_endian);
-                                            if (ret.is_failed())
-                                            {
-                                                err = std::move(ret).err();
-                                            }
-                                            else
-                                            {
-                                                this_offset += serializer.size(value);
-                                            }
-                                        }
-                                        ++i;
-                                    });
-                                if (err.has_value())
+                            static const meta_info::MetaInfo<ValueType> info{};
+                            std::optional<OSPFError> err;
+                            usize j{ 0_uz };
+                            info.for_each(obj, [this, bg, ed, &j, &this_it, &err](const auto& obj, const auto& field)
                                 {
-                                    return std::move(err).value();
-                                }
-                                else
-                                {
-                                    return succeed;
-                                }
-                            }));
-                    }
-                    for (auto& future : futures)
-                    {
-                        OSPF_TRY_EXEC(future.get());
-                    }
+                                    using FieldValueType = OriginType<decltype(field.value(obj))>;
+                                    static_assert(SerializableToBytes<FieldValueType>);
+
+                                    const auto index = j++;
+                                    if (err.has_value() || index < bg || index >= ed)
+                                    {
+                                        return;
+                                    }
+
+                                    static const ToBytesValue<FieldValueType> serializer{};
+                                    auto result = serializer(field.value(obj), this_it, this->_endian);
+                                    if (result.is_failed())
+                                    {
+                                        err = std::move(result).err();
+                                    }
+                                });
+                            if (err.has_value())
+                            {
+                                return std::move(err).value();
+                            }
+                            else
+                            {
+                                return succeed;
+                            }
+                        }, 1_uz));
 #else
                     static const ToBytesValue<ValueType> serializer{};
-                    serializer(obj, ret.begin() + header_size, _endian);
+                    OSPF_TRY_EXEC(serializer(obj, it, _endian));
 #endif
                     return std::move(ret);
                 }
@@ -159,7 +158,7 @@ namespace ospf
                     requires WithMetaInfo<ValueType>
                 inline Try<> operator()(const ValueType& obj, It& it) const noexcept
                 {
-                    const auto header = make_header(obj, _transfer, _endian);
+                    const auto header = make_header(obj, _transfer, _endian, _segement_bytes);
                     static const ToBytesValue<Header> header_serializer{};
                     header_serializer(header, it, _endian);
                     static const ToBytesValue<ValueType> serializer{};
@@ -170,6 +169,7 @@ namespace ospf
             private:
                 std::optional<NameTransfer> _transfer;
                 Endian _endian;
+                usize _segement_bytes{ Header::default_segement_bytes };
             };
 
             template<typename T, usize len>
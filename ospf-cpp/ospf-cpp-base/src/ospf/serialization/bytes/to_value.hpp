@@ -10,6 +10,8 @@
 #include <ospf/meta_programming/meta_info.hpp>
 #include <ospf/meta_programming/variable_type_list.hpp>
 #include <ospf/serialization/bytes/concepts.hpp>
+#include <algorithm>
+#include <array>
 #include <deque>
 #include <span>
 
@@ -327,21 +329,35 @@ namespace ospf
             {
                 inline const usize size(const std::array<T, len>& values) const noexcept
                 {
-                    return address_length + std::accumulate(values.cbegin(), values.cend(), 0_uz, [](const usize lhs, const auto& rhs)
-                        {
-                            static const ToBytesValue<OriginType<T>> serializer{};
-                            return lhs + serializer.size(rhs);
-                        });
+                    if constexpr (BlockSerializable<T>)
+                    {
+                        return address_length + values.size() * sizeof(T);
+                    }
+                    else
+                    {
+                        return address_length + std::accumulate(values.cbegin(), values.cend(), 0_uz, [](const usize lhs, const auto& rhs)
+                            {
+                                static const ToBytesValue<OriginType<T>> serializer{};
+                                return lhs + serializer.size(rhs);
+                            });
+                    }
                 }
 
                 template<ToValueIter It>
                 inline Try<> operator()(const std::array<T, len>& values, It& it, const Endian endian) const noexcept
                 {
                     to_bytes<usize>(values.size(), it, endian);
-                    for (const auto& value : values)
+                    if constexpr (BlockSerializable<T>)
                     {
-                        static const ToBytesValue<OriginType<T>> serializer{};
-                        OSPF_TRY_EXEC(serializer(value, it, endian));
+                        to_bytes_block<T>(std::span<const T>{ values.data(), values.size() }, it, endian);
+                    }
+                    else
+                    {
+                        for (const auto& value : values)
+                        {
+                            static const ToBytesValue<OriginType<T>> serializer{};
+                            OSPF_TRY_EXEC(serializer(value, it, endian));
+                        }
                     }
                     return succeed;
                 }
@@ -353,21 +369,35 @@ namespace ospf
             {
                 inline const usize size(const std::vector<T>& values) const noexcept
                 {
-                    return address_length + std::accumulate(values.cbegin(), values.cend(), 0_uz, [](const usize lhs, const auto& rhs)
-                        {
-                            static const ToBytesValue<OriginType<T>> serializer{};
-                            return lhs + serializer.size(rhs);
-                        });
+                    if constexpr (BlockSerializable<T>)
+                    {
+                        return address_length + values.size() * sizeof(T);
+                    }
+                    else
+                    {
+                        return address_length + std::accumulate(values.cbegin(), values.cend(), 0_uz, [](const usize lhs, const auto& rhs)
+                            {
+                                static const ToBytesValue<OriginType<T>> serializer{};
+                                return lhs + serializer.size(rhs);
+                            });
+                    }
                 }
 
                 template<ToValueIter It>
                 inline Try<> operator()(const std::vector<T>& values, It& it, const Endian endian) const noexcept
                 {
                     to_bytes<usize>(values.size(), it, endian);
-                    for (const auto& value : values)
+                    if constexpr (BlockSerializable<T>)
                     {
-                        static const ToBytesValue<OriginType<T>> serializer{};
-                        OSPF_TRY_EXEC(serializer(value, it, endian));
+                        to_bytes_block<T>(std::span<const T>{ values.data(), values.size() }, it, endian);
+                    }
+                    else
+                    {
+                        for (const auto& value : values)
+                        {
+                            static const ToBytesValue<OriginType<T>> serializer{};
+                            OSPF_TRY_EXEC(serializer(value, it, endian));
+                        }
                     }
                     return succeed;
                 }
@@ -379,21 +409,42 @@ namespace ospf
             {
                 inline const usize size(const std::deque<T>& values) const noexcept
                 {
-                    return address_length + std::accumulate(values.cbegin(), values.cend(), 0_uz, [](const usize lhs, const auto& rhs)
-                        {
-                            static const ToBytesValue<OriginType<T>> serializer{};
-                            return lhs + serializer.size(rhs);
-                        });
+                    if constexpr (BlockSerializable<T>)
+                    {
+                        return address_length + values.size() * sizeof(T);
+                    }
+                    else
+                    {
+                        return address_length + std::accumulate(values.cbegin(), values.cend(), 0_uz, [](const usize lhs, const auto& rhs)
+                            {
+                                static const ToBytesValue<OriginType<T>> serializer{};
+                                return lhs + serializer.size(rhs);
+                            });
+                    }
                 }
 
                 template<ToValueIter It>
                 inline Try<> operator()(const std::deque<T>& values, It& it, const Endian endian) const noexcept
                 {
                     to_bytes<usize>(values.size(), it, endian);
-                    for (const auto& value : values)
+                    if constexpr (BlockSerializable<T>)
                     {
-                        static const ToBytesValue<OriginType<T>> serializer{};
-                        OSPF_TRY_EXEC(serializer(value, it, endian));
+                        // staged through a buffer, the elements of a deque are only contiguous piecewise
+                        std::array<T, block_buffer_size<T>> buffer{};
+                        for (usize i{ 0_uz }; i < values.size(); i += buffer.size())
+                        {
+                            const auto amount = (std::min)(buffer.size(), values.size() - i);
+                            std::copy_n(values.cbegin() + i, amount, buffer.begin());
+                            to_bytes_block<T>(std::span<const T>{ buffer.data(), amount }, it, endian);
+                        }
+                    }
+                    else
+                    {
+                        for (const auto& value : values)
+                        {
+                            static const ToBytesValue<OriginType<T>> serializer{};
+                            OSPF_TRY_EXEC(serializer(value, it, endian));
+                        }
                     }
                     return succeed;
                 }
@@ -405,21 +456,35 @@ namespace ospf
             {
                 inline const usize size(const std::span<const T, len> values) const noexcept
                 {
-                    return address_length + std::accumulate(values.begin(), values.end(), 0_uz, [](const usize lhs, const auto& rhs)
-                        {
-                            static const ToBytesValue<OriginType<T>> serializer{};
-                            return lhs + serializer.size(rhs);
-                        });
+                    if constexpr (BlockSerializable<T>)
+                    {
+                        return address_length + values.size() * sizeof(T);
+                    }
+                    else
+                    {
+                        return address_length + std::accumulate(values.begin(), values.end(), 0_uz, [](const usize lhs, const auto& rhs)
+                            {
+                                static const ToBytesValue<OriginType<T>> serializer{};
+                                return lhs + serializer.size(rhs);
+                            });
+                    }
                 }
 
                 template<ToValueIter It>
                 inline Try<> operator()(const std::span<const T, len> values, It& it, const Endian endian) const noexcept
                 {
                     to_bytes<usize>(values.size(), it, endian);
-                    for (const auto& value : values)
+                    if constexpr (BlockSerializable<T>)
                     {
-                        static const ToBytesValue<OriginType<T>> serializer{};
-                        OSPF_TRY_EXEC(serializer(value, it, endian));
+                        to_bytes_block<T>(std::span<const T>{ values.data(), values.size() }, it, endian);
+                    }
+                    else
+                    {
+                        for (const auto& value : values)
+                        {
+                            static const ToBytesValue<OriginType<T>> serializer{};
+                            OSPF_TRY_EXEC(serializer(value, it, endian));
+                        }
                     }
                     return succeed;
                 }
@@ -864,6 +929,38 @@ namespace ospf
                 }
             };
 
+            template<>
+            struct ToBytesValue<f32>
+            {
+                inline const usize size(const f32 value) const noexcept
+                {
+                    return 4_uz;
+                }
+
+                template<ToValueIter It>
+                inline Try<> operator()(const f32 value, It& it, const Endian endian) const noexcept
+                {
+                    to_bytes<f32>(value, it, endian);
+                    return succeed;
+                }
+            };
+
+            template<>
+            struct ToBytesValue<f64>
+            {
+                inline const usize size(const f64 value) const noexcept
+                {
+                    return 8_uz;
+                }
+
+                template<ToValueIter It>
+                inline Try<> operator()(const f64 value, It& it, const Endian endian) const noexcept
+                {
+                    to_bytes<f64>(value, it, endian);
+                    return succeed;
+                }
+            };
+
             template<>
             struct ToBytesValue<std::string>
             {
@@ -876,7 +973,7 @@ namespace ospf
                 inline Try<> operator()(const std::string& value, It& it, const Endian endian) const noexcept
                 {
                     to_bytes<usize>(value.size(), it, endian);
-                    std::transform(value.cbegin(), value.cend(), it, [](const char ch) { return static_cast<ubyte>(ch); });
+                    it = std::transform(value.cbegin(), value.cend(), it, [](const char ch) { return static_cast<ubyte>(ch); });
                     return succeed;
                 }
             };
@@ -893,7 +990,7 @@ namespace ospf
                 inline Try<> operator()(const std::string_view value, It& it, const Endian endian) const noexcept
                 {
                     to_bytes<usize>(value.size(), it, endian);
-                    std::transform(value.cbegin(), value.cend(), it, [](const char ch) { return static_cast<ubyte>(ch); });
+                    it = std::transform(value.cbegin(), value.cend(), it, [](const char ch) { return static_cast<ubyte>(ch); });
                     return succeed;
                 }
             };
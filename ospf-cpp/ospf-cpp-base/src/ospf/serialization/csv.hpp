@@ -6,3 +6,4 @@
 #include <ospf/serialization/csv/serializer.hpp>
 #include <ospf/serialization/csv/deserializer.hpp>
 #include <ospf/serialization/csv/io.hpp>
+#include <ospf/serialization/csv/mapped.hpp>
@@ -6,24 +6,34 @@
 #include <ospf/serialization/csv/io.hpp>
 #include <ospf/serialization/nullable.hpp>
 #include <ospf/serialization/writable.hpp>
-#include <ospf/string/hasher.hpp>
+#include <array>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
 
+#ifdef OSPF_MULTI_THREAD
+#include <ospf/parallelism/thread_pool.hpp>
+#endif
+
 namespace ospf
 {
     inline namespace serialization
     {
         namespace csv
         {
-            // todo: impl multi-thread optimization
+            namespace csv_detail
+            {
+                // tables with less rows than this are deserialized on the calling thread
+                static constexpr const usize parallel_deserialize_threshold = 1_uz << 12_uz;
+            };
 
             template<WithMetaInfo T, CharType CharT = char>
             class Deserializer
             {
             public:
-                using ColumnMap = StringHashMap<std::basic_string_view<CharT>, usize>;
+                // column of every field by its ordinal in the meta info, npos if there is not
+                using ColumnMap = std::array<usize, meta_info::MetaInfo<OriginType<T>>{}.size()>;
                 using ValueType = OriginType<T>;
                 using HeaderType = data_table::DataTableHeader<CharT>;
                 using RowType = ORMRowType<ValueType, CharT>;
@@ -44,138 +54,254 @@ namespace ospf
                     requires WithDefault<ValueType>
                 inline Result<std::vector<ValueType>> operator()(const CSVTable<CharT>& table) const noexcept
                 {
-                    static constexpr const meta_info::MetaInfo<ValueType> info{};
-                    OSPF_TRY_GET(column_map, parse_header(info, table.header()));
-                    std::vector<ValueType> ret;
-                    for (const auto& row : table.rows())
-                    {
-                        ValueType obj = DefaultValue<ValueType>::value();
-                        OSPF_TRY_EXEC(deserialize(obj, info, row, column_map));
-                        ret.push_back(std::move(obj));
-                    }
-                    return std::move(ret);
+                    return deserialize_table(table, []()
+                        {
+                            return DefaultValue<ValueType>::value();
+                        });
                 }
 
                 template<typename = void>
                     requires std::copyable<ValueType>
                 inline Result<std::vector<ValueType>> operator()(const CSVTable<CharT>& table, const ValueType& origin_obj) const noexcept
                 {
-                    static constexpr const meta_info::MetaInfo<ValueType> info{};
-                    OSPF_TRY_GET(column_map, parse_header(info, table.header()));
-                    std::vector<ValueType> ret;
-                    for (const auto& row : table.rows())
-                    {
-                        ValueType obj{ origin_obj };
-                        OSPF_TRY_EXEC(deserialize(obj, info, row, column_map));
-                        ret.push_back(std::move(obj));
-                    }
-                    return std::move(ret);
+                    return deserialize_table(table, [&origin_obj]()
+                        {
+                            return ValueType{ origin_obj };
+                        });
                 }
 
                 template<typename = void>
                     requires WithDefault<ValueType>
                 inline Result<std::vector<ValueType>> operator()(const CSVViewTable<CharT>& table) const noexcept
                 {
-                    static constexpr const meta_info::MetaInfo<ValueType> info{};
-                    OSPF_TRY_GET(column_map, parse_header(info, table.header()));
-                    std::vector<ValueType> ret;
-                    for (const auto& row : table.rows())
-                    {
-                        ValueType obj = DefaultValue<ValueType>::value();
-                        OSPF_TRY_EXEC(deserialize(obj, info, row, column_map));
-                        ret.push_back(std::move(obj));
-                    }
-                    return std::move(ret);
+                    return deserialize_table(table, []()
+                        {
+                            return DefaultValue<ValueType>::value();
+                        });
                 }
 
                 template<typename = void>
                     requires std::copyable<ValueType>
                 inline Result<std::vector<ValueType>> operator()(const CSVViewTable<CharT>& table, const ValueType& origin_obj) const noexcept
                 {
-                    static constexpr const meta_info::MetaInfo<ValueType> info{};
-                    OSPF_TRY_GET(column_map, parse_header(info, table.header()));
-                    std::vector<ValueType> ret;
-                    for (const auto& row : table.rows())
-                    {
-                        ValueType obj{ origin_obj };
-                        OSPF_TRY_EXEC(deserialize(obj, info, row, column_map));
-                        ret.push_back(std::move(obj));
-                    }
-                    return std::move(ret);
+                    return deserialize_table(table, [&origin_obj]()
+                        {
+                            return ValueType{ origin_obj };
+                        });
                 }
 
                 template<typename = void>
                     requires WithDefault<ValueType>
                 inline Result<std::vector<ValueType>> operator()(const ORMTableType<ValueType, CharT>& table) const noexcept
                 {
-                    static constexpr const meta_info::MetaInfo<ValueType> info{};
-                    OSPF_TRY_GET(column_map, parse_header(info, table.header()));
-                    std::vector<ValueType> ret;
-                    for (const auto& row : table.rows())
-                    {
-                        ValueType obj = DefaultValue<ValueType>::value();
-                        OSPF_TRY_EXEC(deserialize(obj, info, row, column_map));
-                        ret.push_back(std::move(obj));
-                    }
-                    return std::move(ret);
+                    return deserialize_table(table, []()
+                        {
+                            return DefaultValue<ValueType>::value();
+                        });
                 }
 
                 template<typename = void>
                     requires std::copyable<ValueType>
                 inline Result<std::vector<ValueType>> operator()(const ORMTableType<ValueType, CharT>& table, const ValueType& origin_obj) const noexcept
                 {
-                    static constexpr const meta_info::MetaInfo<ValueType> info{};
-                    OSPF_TRY_GET(column_map, parse_header(info, table.header()));
-                    std::vector<ValueType> ret;
-                    for (const auto& row : table.rows())
-                    {
-                        ValueType obj{ origin_obj };
-                        OSPF_TRY_EXEC(deserialize(obj, info, row, column_map));
-                        ret.push_back(std::move(obj));
-                    }
-                    return std::move(ret);
+                    return deserialize_table(table, [&origin_obj]()
+                        {
+                            return ValueType{ origin_obj };
+                        });
                 }
 
                 template<typename = void>
                     requires WithDefault<ValueType>
                 inline Result<std::vector<ValueType>> operator()(const ORMViewTableType<ValueType, CharT>& table) const noexcept
                 {
-                    static constexpr const meta_info::MetaInfo<ValueType> info{};
-                    OSPF_TRY_GET(column_map, parse_header(info, table.header()));
-                    std::vector<ValueType> ret;
-                    for (const auto& row : table.rows())
-                    {
-                        ValueType obj = DefaultValue<ValueType>::value();
-                        OSPF_TRY_EXEC(deserialize(obj, info, row, column_map));
-                        ret.push_back(std::move(obj));
-                    }
-                    return std::move(ret);
+                    return deserialize_table(table, []()
+                        {
+                            return DefaultValue<ValueType>::value();
+                        });
                 }
 
                 template<typename = void>
                     requires std::copyable<ValueType>
                 inline Result<std::vector<ValueType>> operator()(const ORMViewTableType<ValueType, CharT>& table, const ValueType& origin_obj) const noexcept
+                {
+                    return deserialize_table(table, [&origin_obj]()
+                        {
+                            return ValueType{ origin_obj };
+                        });
+                }
+
+                // read the stream row by row and call func with every object, only one row is held in memory at a time
+                // func can return void or Try<>, a failure stops the reading and is returned
+                template<typename F>
+                    requires WithDefault<ValueType> && std::invocable<F, ValueType>
+                inline Try<> operator()(std::basic_istream<CharT>& is, F&& func, const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator) const noexcept
+                {
+                    return deserialize_stream(is, []()
+                        {
+                            return DefaultValue<ValueType>::value();
+                        }, func, seperator);
+                }
+
+                template<typename F>
+                    requires std::copyable<ValueType> && std::invocable<F, ValueType>
+                inline Try<> operator()(std::basic_istream<CharT>& is, const ValueType& origin_obj, F&& func, const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator) const noexcept
+                {
+                    return deserialize_stream(is, [&origin_obj]()
+                        {
+                            return ValueType{ origin_obj };
+                        }, func, seperator);
+                }
+
+            private:
+                // the header is parsed once, rows are deserialized in ranges concurrently if the table is large enough
+                // the error of the first failing row is returned
+                template<typename TableType, typename F>
+                inline Result<std::vector<ValueType>> deserialize_table(const TableType& table, const F& constructor) const noexcept
                 {
                     static constexpr const meta_info::MetaInfo<ValueType> info{};
                     OSPF_TRY_GET(column_map, parse_header(info, table.header()));
+                    const auto row = table.row();
+#ifdef OSPF_MULTI_THREAD
+                    if (row >= csv_detail::parallel_deserialize_threshold)
+                    {
+                        auto& pool = ThreadPool::instance();
+                        const auto range_amount = (std::min)(pool.worker_amount() * 4_uz, row);
+                        const auto range_size = (row + range_amount - 1_uz) / range_amount;
+                        // the objects are constructed in the result first, so that every range deserializes its rows in place
+                        std::vector<ValueType> ret;
+                        ret.reserve(row);
+                        for (usize i{ 0_uz }; i != row; ++i)
+                        {
+                            ret.push_back(constructor());
+                        }
+                        std::atomic<usize> first_failed_row{ npos };
+                        OSPF_TRY_EXEC(pool.parallel_for(0_uz, range_amount, [this, &table, &column_map, &ret, &first_failed_row, row, range_size](const usize k) -> Try<>
+                            {
+                                const auto bg = k * range_size;
+                                const auto ed = (std::min)(bg + range_size, row);
+                                for (usize i{ bg }; i < ed; ++i)
+                                {
+                                    if (i > first_failed_row.load(std::memory_order_relaxed))
+                                    {
+                                        // an earlier row has failed, this range is useless
+                                        return succeed;
+                                    }
+
+                                    auto this_ret = deserialize(ret[i], info, table.row(i), column_map);
+                                    if (this_ret.is_failed())
+                                    {
+                                        usize expected{ first_failed_row.load(std::memory_order_relaxed) };
+                                        while (i < expected && !first_failed_row.compare_exchange_weak(expected, i, std::memory_order_relaxed)) {}
+                                        return row_error(i, std::move(this_ret).err());
+                                    }
+                                }
+                                return succeed;
+                            }, 1_uz));
+                        return std::move(ret);
+                    }
+#endif
                     std::vector<ValueType> ret;
-                    for (const auto& row : table.rows())
+                    ret.reserve(row);
+                    for (usize i{ 0_uz }; i != row; ++i)
                     {
-                        ValueType obj{ origin_obj };
-                        OSPF_TRY_EXEC(deserialize(obj, info, row, column_map));
+                        ValueType obj = constructor();
+                        auto this_ret = deserialize(obj, info, table.row(i), column_map);
+                        if (this_ret.is_failed())
+                        {
+                            return row_error(i, std::move(this_ret).err());
+                        }
                         ret.push_back(std::move(obj));
                     }
                     return std::move(ret);
                 }
 
-            private:
+                template<typename C, typename F>
+                inline Try<> deserialize_stream(std::basic_istream<CharT>& is, const C& constructor, F& func, const std::basic_string_view<CharT> seperator) const noexcept
+                {
+                    using StringType = std::basic_string<CharT>;
+                    using StringViewType = std::basic_string_view<CharT>;
+
+                    static constexpr const meta_info::MetaInfo<ValueType> info{};
+                    const Tokenizer<CharT> tokenizer{ seperator };
+                    StringType line;
+                    if (!std::getline(is, line))
+                    {
+                        return OSPFError{ OSPFErrCode::DataEmpty };
+                    }
+                    StringViewType header_text{ line };
+                    std::vector<HeaderType> header;
+                    for (auto& name : tokenizer.split(Tokenizer<CharT>::next_line(header_text)))
+                    {
+                        header.push_back(HeaderType{ std::move(name), TypeInfo<StringType>::index() });
+                    }
+                    OSPF_TRY_GET(column_map, parse_header(info, std::span<const HeaderType>{ header }));
+
+                    // the buffers are reused for every row, escaped cells are unescaped into the slot of their column
+                    const auto column = header.size();
+                    std::vector<StringViewType> cells(column);
+                    std::vector<StringType> unescaped(column);
+                    for (usize i{ 0_uz }; std::getline(is, line); )
+                    {
+                        StringViewType text{ line };
+                        const auto row = Tokenizer<CharT>::next_line(text);
+                        if (row.empty())
+                        {
+                            continue;
+                        }
+
+                        std::fill(cells.begin(), cells.end(), StringViewType{});
+                        tokenizer.for_each_cell(row, [&cells, &unescaped, column](const usize j, const typename Tokenizer<CharT>::Cell& cell)
+                            {
+                                if (j >= column)
+                                {
+                                    return;
+                                }
+
+                                if (cell.escaped)
+                                {
+                                    unescaped[j] = Tokenizer<CharT>::unescape(cell);
+                                    cells[j] = unescaped[j];
+                                }
+                                else
+                                {
+                                    cells[j] = cell.raw;
+                                }
+                            });
+
+                        ValueType obj = constructor();
+                        auto ret = deserialize(obj, info, std::span<const StringViewType>{ cells }, column_map);
+                        if (ret.is_failed())
+                        {
+                            return row_error(i, std::move(ret).err());
+                        }
+                        if constexpr (std::is_void_v<std::invoke_result_t<F, ValueType>>)
+                        {
+                            func(std::move(obj));
+                        }
+                        else
+                        {
+                            OSPF_TRY_EXEC(func(std::move(obj)));
+                        }
+                        ++i;
+                    }
+                    return succeed;
+                }
+
+                inline static OSPFError row_error(const usize i, OSPFError err) noexcept
+                {
+                    return OSPFError{ err.code(), std::format("row {}: {}", i, err.message()) };
+                }
+
                 template<usize len>
                 inline Result<ColumnMap> parse_header(const meta_info::MetaInfo<T>& info, const std::span<const HeaderType, len> header) const noexcept
                 {
                     ColumnMap column_map;
+                    column_map.fill(npos);
                     std::optional<OSPFError> err;
-                    info.for_each([this, header, &column_map, &err](const auto& field) 
+                    usize i{ 0_uz };
+                    info.for_each([this, header, &column_map, &err, &i](const auto& field) 
                         {
+                            const auto ordinal = i++;
                             using FieldValueType = OriginType<decltype(field.value(std::declval<ValueType>()))>;
                             if constexpr (!field.writable() || !serialization_writable<FieldValueType>)
                             {
@@ -198,9 +324,9 @@ namespace ospf
                                     err = OSPFError{ OSPFErrCode::DeserializationFail, std::format("lost non-nullable column \"{}\" for type \"{}\"", field.key(), TypeInfo<FieldValueType>::name()) };
                                     return;
                                 }
-                                else
+                                else if (it != header.end())
                                 {
-                                    column_map.insert({ field.key(), it - header.begin() });
+                                    column_map[ordinal] = static_cast<usize>(it - header.begin());
                                 }
                             }
                         });
@@ -218,8 +344,10 @@ namespace ospf
                 inline Try<> deserialize(T& obj, const meta_info::MetaInfo<T>& info, const std::span<const std::optional<S>, len> row, const ColumnMap& column_map) const noexcept
                 {
                     std::optional<OSPFError> err;
-                    info.for_each(obj, [this, row, &column_map, err](auto& obj, const auto& field)
+                    usize i{ 0_uz };
+                    info.for_each(obj, [this, row, &column_map, &err, &i](auto& obj, const auto& field)
                         {
+                            const auto ordinal = i++;
                             using FieldValueType = OriginType<decltype(field.value(obj))>;
                             if constexpr (!field.writable() || !serialization_writable<FieldValueType>)
                             {
@@ -235,17 +363,17 @@ namespace ospf
                                     return;
                                 }
 
-                                const auto it = column_map.find(field.key());
+                                const auto column = column_map[ordinal];
                                 if constexpr (serialization_nullable<FieldValueType>)
                                 {
-                                    if (it == column_map.end())
+                                    if (column == npos)
                                     {
                                         return;
                                     }
                                 }
                                 
                                 static const FromCSVValue<FieldValueType, CharT> deserializer{};
-                                auto value = deserializer(*row[it->second]);
+                                auto value = deserializer(*row[column]);
                                 if constexpr (!serialization_nullable<FieldValueType>)
                                 {
                                     if (value.is_failed())
@@ -274,8 +402,10 @@ namespace ospf
                 inline Try<> deserialize(T& obj, const meta_info::MetaInfo<T>& info, const std::span<const S, len> row, const ColumnMap& column_map) const noexcept
                 {
                     std::optional<OSPFError> err;
-                    info.for_each(obj, [this, row, &column_map, &err](auto& obj, const auto& field)
+                    usize i{ 0_uz };
+                    info.for_each(obj, [this, row, &column_map, &err, &i](auto& obj, const auto& field)
                         {
+                            const auto ordinal = i++;
                             using FieldValueType = OriginType<decltype(field.value(obj))>;
                             if constexpr (!field.writable() || !serialization_writable<FieldValueType>)
                             {
@@ -291,17 +421,17 @@ namespace ospf
                                     return;
                                 }
 
-                                const auto it = column_map.find(field.key());
-                                if constexpr (serialization_nullable<ValueType>)
+                                const auto column = column_map[ordinal];
+                                if constexpr (serialization_nullable<FieldValueType>)
                                 {
-                                    if (it == column_map.end())
+                                    if (column == npos)
                                     {
                                         return;
                                     }
                                 }
 
                                 static const FromCSVValue<FieldValueType, CharT> deserializer{};
-                                auto value = deserializer(row[it->second]);
+                                auto value = deserializer(row[column]);
                                 if constexpr (!serialization_nullable<FieldValueType>)
                                 {
                                     if (value.is_failed())
@@ -590,6 +720,54 @@ namespace ospf
                 return from_string_soft(str, origin_obj, std::optional<NameTransfer<CharT>>{ std::move(transfer) }, seperator);
             }
 
+            // deserialize the file row by row without materializing the table, func is called with every object
+            template<typename T, typename F, CharType CharT = char>
+                requires WithMetaInfo<T> && WithDefault<T> && std::invocable<F, T>
+            inline Try<> for_each_from_file(
+                const std::filesystem::path& path,
+                F&& func,
+                std::optional<NameTransfer<CharT>> transfer = NameTransfer<CharT>{ meta_programming::NameTransfer<NamingSystem::SnakeCase, NamingSystem::UpperSnakeCase, CharT>{} },
+                const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator
+            ) noexcept
+            {
+                if (!std::filesystem::exists(path))
+                {
+                    return OSPFError{ OSPFErrCode::FileNotFound, std::format("\"{}\" not exist", path.string()) };
+                }
+                if (std::filesystem::is_directory(path))
+                {
+                    return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" is not a file", path.string()) };
+                }
+
+                std::basic_ifstream<CharT> fin{ path };
+                auto deserializer = transfer.has_value() ? Deserializer<T, CharT>{ std::move(transfer).value() } : Deserializer<T, CharT>{};
+                return deserializer(fin, std::forward<F>(func), seperator);
+            }
+
+            template<typename T, typename F, CharType CharT = char>
+                requires WithMetaInfo<T> && std::copyable<T> && std::invocable<F, T>
+            inline Try<> for_each_from_file(
+                const std::filesystem::path& path,
+                const T& origin_obj,
+                F&& func,
+                std::optional<NameTransfer<CharT>> transfer = NameTransfer<CharT>{ meta_programming::NameTransfer<NamingSystem::SnakeCase, NamingSystem::UpperSnakeCase, CharT>{} },
+                const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator
+            ) noexcept
+            {
+                if (!std::filesystem::exists(path))
+                {
+                    return OSPFError{ OSPFErrCode::FileNotFound, std::format("\"{}\" not exist", path.string()) };
+                }
+                if (std::filesystem::is_directory(path))
+                {
+                    return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" is not a file", path.string()) };
+                }
+
+                std::basic_ifstream<CharT> fin{ path };
+                auto deserializer = transfer.has_value() ? Deserializer<T, CharT>{ std::move(transfer).value() } : Deserializer<T, CharT>{};
+                return deserializer(fin, origin_obj, std::forward<F>(func), seperator);
+            }
+
             // todo: from bytes
         };
     };
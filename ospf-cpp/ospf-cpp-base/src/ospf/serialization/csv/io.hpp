@@ -3,6 +3,13 @@
 #include <ospf/functional/result.hpp>
 #include <ospf/serialization/csv/concepts.hpp>
 #include <ospf/serialization/csv/table.hpp>
+#include <ospf/serialization/csv/tokenizer.hpp>
+#include <deque>
+#include <sstream>
+
+#ifdef OSPF_MULTI_THREAD
+#include <ospf/parallelism/thread_pool.hpp>
+#endif
 
 namespace ospf
 {
@@ -10,6 +17,67 @@ namespace ospf
     {
         namespace csv
         {
+            namespace csv_detail
+            {
+                // rows are formatted into a buffer of this many rows before being written
+                static constexpr const usize write_chunk_row = 1_uz << 12_uz;
+                // tables with less rows than this are formatted on the calling thread
+                static constexpr const usize parallel_write_threshold = 1_uz << 14_uz;
+
+                // same text as CharTrait<CharT>::write
+                template<typename C, CharType CharT>
+                inline void append_cell(std::basic_string<CharT>& buffer, const C& cell, const std::basic_string_view<CharT> seperator) noexcept
+                {
+                    if constexpr (requires { cell.has_value(); })
+                    {
+                        if (cell.has_value())
+                        {
+                            append_cell(buffer, *cell, seperator);
+                        }
+                    }
+                    else
+                    {
+                        const std::basic_string_view<CharT> text{ cell };
+                        if (text.find(seperator) != std::basic_string_view<CharT>::npos)
+                        {
+                            buffer.push_back(CharT{ '\"' });
+                            buffer.append(text);
+                            buffer.push_back(CharT{ '\"' });
+                        }
+                        else
+                        {
+                            buffer.append(text);
+                        }
+                    }
+                }
+
+                template<typename T, CharType CharT>
+                inline void append_rows(std::basic_string<CharT>& buffer, const T& table, const usize bg, const usize ed, const std::basic_string_view<CharT> seperator) noexcept
+                {
+                    const auto column = table.column();
+                    for (usize i{ bg }; i != ed; ++i)
+                    {
+                        const auto row = table.row(i);
+                        for (usize j{ 0_uz }; j != column; ++j)
+                        {
+                            append_cell(buffer, row[j], seperator);
+                            if (j != (column - 1_uz))
+                            {
+                                buffer.append(seperator);
+                            }
+                        }
+                        buffer.append(CharTrait<CharT>::line_breaker);
+                    }
+                }
+
+                template<CharType CharT>
+                inline void flush(std::basic_ostream<CharT>& os, const std::basic_string<CharT>& buffer) noexcept
+                {
+                    os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                }
+            };
+
+            // rows are formatted into buffers chunk by chunk, in parallel for large tables, and written in order
             template<typename T, CharType CharT>
             inline Try<> write(std::basic_ostream<CharT>& os, const T& table, const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator) noexcept
             {
@@ -18,106 +86,242 @@ namespace ospf
                     return OSPFError{ OSPFErrCode::DataEmpty };
                 }
 
+                std::basic_string<CharT> buffer;
                 const auto column = table.column();
                 for (usize j{ 0_uz }; j != column; ++j)
                 {
-                    CharTrait<CharT>::write(os, table.header()[j].name(), seperator);
+                    csv_detail::append_cell(buffer, table.header()[j].name(), seperator);
                     if (j != (column - 1_uz))
                     {
-                        os << seperator;
+                        buffer.append(seperator);
                     }
                 }
-                os << CharTrait<CharT>::line_breaker;
+                buffer.append(CharTrait<CharT>::line_breaker);
+                csv_detail::flush(os, buffer);
 
-                for (const auto& row : table.rows())
+                const auto row = table.row();
+#ifdef OSPF_MULTI_THREAD
+                if (row >= csv_detail::parallel_write_threshold)
                 {
-                    for (usize j{ 0_uz }; j != column; ++j)
+                    auto& pool = ThreadPool::instance();
+                    std::vector<std::basic_string<CharT>> buffers(pool.worker_amount());
+                    const auto batch_row = buffers.size() * csv_detail::write_chunk_row;
+                    for (usize bg{ 0_uz }; bg < row; bg += batch_row)
                     {
-                        CharTrait<CharT>::write(os, row[j], seperator);
-                        if (j != (column - 1_uz))
+                        const auto chunk_amount = (std::min)(buffers.size(), (row - bg + csv_detail::write_chunk_row - 1_uz) / csv_detail::write_chunk_row);
+                        pool.parallel_for(0_uz, chunk_amount, [&table, &buffers, seperator, row, bg](const usize k)
+                            {
+                                const auto this_bg = bg + k * csv_detail::write_chunk_row;
+                                const auto this_ed = (std::min)(this_bg + csv_detail::write_chunk_row, row);
+                                buffers[k].clear();
+                                csv_detail::append_rows(buffers[k], table, this_bg, this_ed, seperator);
+                            }, 1_uz);
+                        for (usize k{ 0_uz }; k != chunk_amount; ++k)
                         {
-                            os << seperator;
+                            csv_detail::flush(os, buffers[k]);
                         }
                     }
+                    return ospf::succeed;
+                }
+#endif
+                for (usize bg{ 0_uz }; bg < row; bg += csv_detail::write_chunk_row)
+                {
+                    buffer.clear();
+                    csv_detail::append_rows(buffer, table, bg, (std::min)(bg + csv_detail::write_chunk_row, row), seperator);
+                    csv_detail::flush(os, buffer);
                 }
-                os << CharTrait<CharT>::line_breaker;
-
                 return ospf::succeed;
             }
 
-            template<CharType CharT>
-            inline Result<CSVTable<CharT>> read(std::basic_istream<CharT>& is, const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator) noexcept
+            namespace csv_detail
             {
-                std::basic_string<CharT> line;
-                if (!std::getline(is, line))
+                // bodies smaller than this are parsed on the calling thread
+                static constexpr const usize parallel_read_threshold = 1_uz << 20_uz;
+
+                template<typename C, CharType CharT>
+                static constexpr const bool is_view_cell = std::is_same_v<C, std::basic_string_view<CharT>> || std::is_same_v<C, std::optional<std::basic_string_view<CharT>>>;
+
+                template<typename C, CharType CharT>
+                struct RowsChunk
                 {
-                    is.setstate(std::ios_base::failbit);
-                    return OSPFError{ OSPFErrCode::DataEmpty };
+                    std::vector<C> cells;
+                    // owns the unescaped content of the view cells whose text cannot be pointed to directly
+                    std::deque<std::basic_string<CharT>> escaped;
+                    usize row = 0_uz;
+                };
+
+                template<CharType CharT>
+                inline std::basic_string<CharT> read_all(std::basic_istream<CharT>& is) noexcept
+                {
+                    std::basic_ostringstream<CharT> sout;
+                    sout << is.rdbuf();
+                    return std::move(sout).str();
+                }
+
+                template<typename C, CharType CharT>
+                inline RowsChunk<C, CharT> parse_chunk(const Tokenizer<CharT>& tokenizer, std::basic_string_view<CharT> text, const usize column) noexcept
+                {
+                    RowsChunk<C, CharT> chunk;
+                    while (!text.empty())
+                    {
+                        const auto line = Tokenizer<CharT>::next_line(text);
+                        if (line.empty())
+                        {
+                            continue;
+                        }
+
+                        const auto offset = chunk.cells.size();
+                        chunk.cells.resize(offset + column);
+                        tokenizer.for_each_cell(line, [&chunk, offset, column](const usize j, const typename Tokenizer<CharT>::Cell& cell)
+                            {
+                                if (j >= column)
+                                {
+                                    return;
+                                }
+
+                                if constexpr (is_view_cell<C, CharT>)
+                                {
+                                    if (cell.escaped)
+                                    {
+                                        chunk.escaped.push_back(Tokenizer<CharT>::unescape(cell));
+                                        chunk.cells[offset + j] = std::basic_string_view<CharT>{ chunk.escaped.back() };
+                                    }
+                                    else
+                                    {
+                                        chunk.cells[offset + j] = cell.raw;
+                                    }
+                                }
+                                else
+                                {
+                                    chunk.cells[offset + j] = Tokenizer<CharT>::unescape(cell);
+                                }
+                            });
+                        ++chunk.row;
+                    }
+                    return chunk;
                 }
 
-                const auto regex_matcher = CharTrait<CharT>::catch_regex(seperator);
-                std::vector<std::basic_string<CharT>> header{};
-                auto headers = regex_catch(line, regex_matcher);
-                for (usize j{ 0_uz }; j != headers.size(); ++j)
+                template<typename C, CharType CharT>
+                inline std::vector<RowsChunk<C, CharT>> parse_body(const Tokenizer<CharT>& tokenizer, const std::basic_string_view<CharT> text, const usize column) noexcept
                 {
-                    header.push_back(CharTrait<CharT>::extract(headers[j], seperator));
+                    std::vector<RowsChunk<C, CharT>> chunks;
+#ifdef OSPF_MULTI_THREAD
+                    if (text.size() >= parallel_read_threshold)
+                    {
+                        auto& pool = ThreadPool::instance();
+                        const auto pieces = Tokenizer<CharT>::split_chunks(text, pool.worker_amount());
+                        chunks.resize(pieces.size());
+                        pool.parallel_for(0_uz, pieces.size(), [&tokenizer, &pieces, &chunks, column](const usize i)
+                            {
+                                chunks[i] = parse_chunk<C>(tokenizer, pieces[i], column);
+                            }, 1_uz);
+                        return chunks;
+                    }
+#endif
+                    chunks.push_back(parse_chunk<C>(tokenizer, text, column));
+                    return chunks;
                 }
 
-                CSVTable table{ std::move(header) };
-                while (std::getline(is, line))
+                template<typename T, typename C, CharType CharT>
+                inline void insert_rows(T& table, std::vector<RowsChunk<C, CharT>>& chunks, const usize column) noexcept
                 {
-                    if (line.empty())
+                    if constexpr (requires { table.reserve(0_uz); })
                     {
-                        continue;
+                        usize row{ 0_uz };
+                        for (const auto& chunk : chunks)
+                        {
+                            row += chunk.row;
+                        }
+                        table.reserve(table.row() + row);
                     }
 
-                    auto this_row = regex_catch(line, regex_matcher);
-                    table.insert_row(table.row(), [&this_row, seperator](const usize j)
+                    for (auto& chunk : chunks)
+                    {
+                        if constexpr (requires { table.append_rows(0_uz, [](const usize, const usize) { return C{}; }); })
                         {
-                            return CharTrait<CharT>::extract(this_row[j], seperator);
-                        });
+                            table.append_rows(chunk.row, [&chunk, column](const usize i, const usize j)
+                                {
+                                    return std::move(chunk.cells[i * column + j]);
+                                });
+                        }
+                        else
+                        {
+                            for (usize i{ 0_uz }; i != chunk.row; ++i)
+                            {
+                                const auto offset = i * column;
+                                table.insert_row(table.row(), [&chunk, offset](const usize j)
+                                    {
+                                        return std::move(chunk.cells[offset + j]);
+                                    });
+                            }
+                        }
+                        chunk.cells.clear();
+                        chunk.cells.shrink_to_fit();
+                    }
                 }
+            };
+
+            template<CharType CharT>
+            inline Result<CSVTable<CharT>> parse(std::basic_string_view<CharT> text, const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator) noexcept
+            {
+                if (text.empty())
+                {
+                    return OSPFError{ OSPFErrCode::DataEmpty };
+                }
+
+                const Tokenizer<CharT> tokenizer{ seperator };
+                auto header = tokenizer.split(Tokenizer<CharT>::next_line(text));
+                CSVTable<CharT> table{ std::span<std::basic_string<CharT>>{ header } };
+                auto chunks = csv_detail::parse_body<typename CSVTable<CharT>::CellType>(tokenizer, text, header.size());
+                csv_detail::insert_rows(table, chunks, header.size());
                 return std::move(table);
             }
 
             template<usize col, CharType CharT>
-            inline Result<ORMCSVTable<col, CharT>> read(std::basic_istream<CharT>& is, const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator) noexcept
+            inline Result<ORMCSVTable<col, CharT>> parse(std::basic_string_view<CharT> text, const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator) noexcept
             {
-                std::basic_string<CharT> line;
-                if (!std::getline(is, line))
+                if (text.empty())
                 {
-                    is.setstate(std::ios_base::failbit);
                     return OSPFError{ OSPFErrCode::DataEmpty };
                 }
 
-                const auto regex_matcher = CharTrait<CharT>::catch_regex(seperator);
-                std::array<std::basic_string<CharT>, col> header{};
-                auto headers = regex_catch(line, regex_matcher);
+                const Tokenizer<CharT> tokenizer{ seperator };
+                auto headers = tokenizer.split(Tokenizer<CharT>::next_line(text));
                 if (headers.size() != col)
                 {
                     return OSPFError{ OSPFErrCode::DeserializationFail, "unmatched header size" };
                 }
-                for (usize j{ 0_uz }; j != col; ++j)
+                std::array<std::basic_string<CharT>, col> header{};
+                std::move(headers.begin(), headers.end(), header.begin());
+
+                ORMCSVTable<col, CharT> table{ header };
+                auto chunks = csv_detail::parse_body<typename ORMCSVTable<col, CharT>::CellType>(tokenizer, text, col);
+                csv_detail::insert_rows(table, chunks, col);
+                return std::move(table);
+            }
+
+            template<CharType CharT>
+            inline Result<CSVTable<CharT>> read(std::basic_istream<CharT>& is, const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator) noexcept
+            {
+                const auto text = csv_detail::read_all(is);
+                if (text.empty())
                 {
-                    header[j] = CharTrait<CharT>::extract(headers[j], seperator);
+                    is.setstate(std::ios_base::failbit);
+                    return OSPFError{ OSPFErrCode::DataEmpty };
                 }
+                return parse(std::basic_string_view<CharT>{ text }, seperator);
+            }
 
-                ORMCSVTable<col> table{ header };
-                while (std::getline(is, line))
+            template<usize col, CharType CharT>
+            inline Result<ORMCSVTable<col, CharT>> read(std::basic_istream<CharT>& is, const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator) noexcept
+            {
+                const auto text = csv_detail::read_all(is);
+                if (text.empty())
                 {
-                    if (line.empty())
-                    {
-                        continue;
-                    }
-
-                    auto this_row = regex_catch(line, regex_matcher);
-                    table.insert_row(table.row(), [&this_row, seperator](const usize j)
-                        {
-                            return CharTrait<CharT>::extract(this_row[j], seperator);
-                        });
+                    is.setstate(std::ios_base::failbit);
+                    return OSPFError{ OSPFErrCode::DataEmpty };
                 }
-                
-                return std::move(table);
+                return parse<col>(std::basic_string_view<CharT>{ text }, seperator);
             }
         };
     };
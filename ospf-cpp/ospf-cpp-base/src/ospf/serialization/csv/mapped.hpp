@@ -0,0 +1,124 @@
+﻿#pragma once
+
+#include <ospf/bytes/mapped_file.hpp>
+#include <ospf/functional/result.hpp>
+#include <ospf/serialization/csv/io.hpp>
+#include <ospf/serialization/csv/table.hpp>
+#include <deque>
+#include <filesystem>
+
+namespace ospf
+{
+    inline namespace serialization
+    {
+        namespace csv
+        {
+            // view table over a memory mapped file, cells point into the mapping except for the ones with escaped quotes
+            // the mapping is kept alive as long as the table, moving the table keeps its cells valid
+            template<typename T, CharType CharT>
+            class MappedTable
+            {
+            public:
+                using TableType = T;
+                using StringType = std::basic_string<CharT>;
+
+            public:
+                MappedTable(MappedFile file, std::vector<std::deque<StringType>> escaped, TableType table)
+                    : _file(std::move(file)), _escaped(std::move(escaped)), _table(std::move(table)) {}
+                MappedTable(const MappedTable& ano) = delete;
+                MappedTable(MappedTable&& ano) noexcept = default;
+                MappedTable& operator=(const MappedTable& rhs) = delete;
+                MappedTable& operator=(MappedTable&& rhs) noexcept = default;
+                ~MappedTable(void) noexcept = default;
+
+            public:
+                inline const TableType& table(void) const noexcept
+                {
+                    return _table;
+                }
+
+                inline const MappedFile& file(void) const noexcept
+                {
+                    return _file;
+                }
+
+                inline operator const TableType&(void) const noexcept
+                {
+                    return _table;
+                }
+
+            private:
+                MappedFile _file;
+                std::vector<std::deque<StringType>> _escaped;
+                TableType _table;
+            };
+
+            template<CharType CharT = char>
+            using MappedCSVViewTable = MappedTable<CSVViewTable<CharT>, CharT>;
+
+            template<usize col, CharType CharT = char>
+            using MappedORMCSVViewTable = MappedTable<ORMCSVViewTable<col, CharT>, CharT>;
+
+            namespace csv_detail
+            {
+                template<typename C, CharType CharT>
+                inline std::vector<std::deque<std::basic_string<CharT>>> take_escaped(std::vector<RowsChunk<C, CharT>>& chunks) noexcept
+                {
+                    std::vector<std::deque<std::basic_string<CharT>>> escaped;
+                    for (auto& chunk : chunks)
+                    {
+                        if (!chunk.escaped.empty())
+                        {
+                            // moving a deque keeps its elements in place, so the views stay valid
+                            escaped.push_back(std::move(chunk.escaped));
+                        }
+                    }
+                    return escaped;
+                }
+            };
+
+            template<CharType CharT = char>
+            inline Result<MappedCSVViewTable<CharT>> map(const std::filesystem::path& path, const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator) noexcept
+            {
+                OSPF_TRY_GET(file, MappedFile::open(path));
+                auto text = file.text<CharT>();
+                if (text.empty())
+                {
+                    return OSPFError{ OSPFErrCode::DataEmpty, std::format("\"{}\" is empty", path.string()) };
+                }
+
+                const Tokenizer<CharT> tokenizer{ seperator };
+                auto header = tokenizer.split(Tokenizer<CharT>::next_line(text));
+                CSVViewTable<CharT> table{ std::span<std::basic_string<CharT>>{ header } };
+                auto chunks = csv_detail::parse_body<typename CSVViewTable<CharT>::CellType>(tokenizer, text, header.size());
+                csv_detail::insert_rows(table, chunks, header.size());
+                return MappedCSVViewTable<CharT>{ std::move(file), csv_detail::take_escaped(chunks), std::move(table) };
+            }
+
+            template<usize col, CharType CharT = char>
+            inline Result<MappedORMCSVViewTable<col, CharT>> map(const std::filesystem::path& path, const std::basic_string_view<CharT> seperator = CharTrait<CharT>::default_seperator) noexcept
+            {
+                OSPF_TRY_GET(file, MappedFile::open(path));
+                auto text = file.text<CharT>();
+                if (text.empty())
+                {
+                    return OSPFError{ OSPFErrCode::DataEmpty, std::format("\"{}\" is empty", path.string()) };
+                }
+
+                const Tokenizer<CharT> tokenizer{ seperator };
+                auto headers = tokenizer.split(Tokenizer<CharT>::next_line(text));
+                if (headers.size() != col)
+                {
+                    return OSPFError{ OSPFErrCode::DeserializationFail, "unmatched header size" };
+                }
+                std::array<std::basic_string<CharT>, col> header{};
+                std::move(headers.begin(), headers.end(), header.begin());
+
+                ORMCSVViewTable<col, CharT> table{ header };
+                auto chunks = csv_detail::parse_body<typename ORMCSVViewTable<col, CharT>::CellType>(tokenizer, text, col);
+                csv_detail::insert_rows(table, chunks, col);
+                return MappedORMCSVViewTable<col, CharT>{ std::move(file), csv_detail::take_escaped(chunks), std::move(table) };
+            }
+        };
+    };
+};
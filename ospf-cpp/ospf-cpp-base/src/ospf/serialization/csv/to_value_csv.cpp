@@ -1,7 +1,31 @@
-﻿#include <ospf/serialization/csv/to_value.hpp>
+﻿#include <ospf/literal_constant.hpp>
+#include <ospf/serialization/csv/to_value.hpp>
+#include <array>
+#include <charconv>
+#include <limits>
 
 namespace ospf::serialization::csv
 {
+    namespace
+    {
+        // same text as std::to_string, without its locale aware sprintf
+        template<std::integral T>
+        inline std::string integer_to_string(const T value) noexcept
+        {
+            std::array<char, std::numeric_limits<T>::digits10 + 3_uz> buffer{};
+            const auto ret = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+            return std::string{ buffer.data(), ret.ptr };
+        }
+
+        inline std::string floating_to_string(const f64 value) noexcept
+        {
+            // std::to_string formats floating numbers as "%f"
+            std::array<char, std::numeric_limits<f64>::max_exponent10 + 16_uz> buffer{};
+            const auto ret = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::fixed, 6);
+            return std::string{ buffer.data(), ret.ptr };
+        }
+    };
+
     std::string from_bool(const bool value) noexcept
     {
         return value ? "true" : "false";
@@ -9,51 +33,51 @@ namespace ospf::serialization::csv
 
     std::string from_u8(const u8 value) noexcept
     {
-        return std::to_string(value);
+        return integer_to_string(value);
     }
 
     std::string from_i8(const i8 value) noexcept
     {
-        return std::to_string(value);
+        return integer_to_string(value);
     }
 
     std::string from_u16(const u16 value) noexcept
     {
-        return std::to_string(value);
+        return integer_to_string(value);
     }
 
     std::string from_i16(const i16 value) noexcept
     {
-        return std::to_string(value);
+        return integer_to_string(value);
     }
 
     std::string from_u32(const u32 value) noexcept
     {
-        return std::to_string(value);
+        return integer_to_string(value);
     }
 
     std::string from_i32(const i32 value) noexcept
     {
-        return std::to_string(value);
+        return integer_to_string(value);
     }
 
     std::string from_u64(const u64 value) noexcept
     {
-        return std::to_string(value);
+        return integer_to_string(value);
     }
 
     std::string from_i64(const i64 value) noexcept
     {
-        return std::to_string(value);
+        return integer_to_string(value);
     }
 
     std::string from_f32(const f32 value) noexcept
     {
-        return std::to_string(value);
+        return floating_to_string(static_cast<f64>(value));
     }
 
     std::string from_f64(const f64 value) noexcept
     {
-        return std::to_string(value);
+        return floating_to_string(static_cast<f64>(value));
     }
 };
@@ -0,0 +1,230 @@
+﻿#pragma once
+
+#include <ospf/literal_constant.hpp>
+#include <ospf/serialization/csv/concepts.hpp>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ospf
+{
+    inline namespace serialization
+    {
+        namespace csv
+        {
+            // hand-written csv tokenizer
+            // a row is a physical line, cells are split by the seperator outside of quotes,
+            // a quoted cell keeps the content between its quotes with "" standing for ",
+            // anything between a closing quote and the next seperator is ignored
+            template<CharType CharT>
+            class Tokenizer
+            {
+            public:
+                using StringType = std::basic_string<CharT>;
+                using StringViewType = std::basic_string_view<CharT>;
+
+                struct Cell
+                {
+                    StringViewType raw;
+                    bool escaped;
+                };
+
+            private:
+                enum class State : u8
+                {
+                    CellBegin,
+                    Unquoted,
+                    Quoted,
+                    QuoteInQuoted,
+                    Closed
+                };
+
+            public:
+                Tokenizer(const StringViewType seperator = CharTrait<CharT>::default_seperator)
+                    : _seperator(seperator) {}
+                Tokenizer(const Tokenizer& ano) = default;
+                Tokenizer(Tokenizer&& ano) noexcept = default;
+                Tokenizer& operator=(const Tokenizer& rhs) = default;
+                Tokenizer& operator=(Tokenizer&& rhs) noexcept = default;
+                ~Tokenizer(void) noexcept = default;
+
+            public:
+                inline const StringViewType seperator(void) const noexcept
+                {
+                    return _seperator;
+                }
+
+            public:
+                // take the next line of text without its line breaker, text is moved behind it
+                inline static const StringViewType next_line(StringViewType& text) noexcept
+                {
+                    const auto pos = text.find(CharT{ '\n' });
+                    auto line = pos == StringViewType::npos ? text : text.substr(0_uz, pos);
+                    text = pos == StringViewType::npos ? StringViewType{} : text.substr(pos + 1_uz);
+                    if (!line.empty() && line.back() == CharT{ '\r' })
+                    {
+                        line.remove_suffix(1_uz);
+                    }
+                    return line;
+                }
+
+                // split text into at most amount pieces, each of them ends behind a line breaker or at the end of text
+                inline static std::vector<StringViewType> split_chunks(const StringViewType text, const usize amount) noexcept
+                {
+                    std::vector<StringViewType> chunks;
+                    if (text.empty())
+                    {
+                        return chunks;
+                    }
+                    const auto step = (std::max)(text.size() / (std::max)(amount, 1_uz), 1_uz);
+                    chunks.reserve(amount);
+                    usize bg{ 0_uz };
+                    while (bg < text.size())
+                    {
+                        auto ed = bg + step;
+                        if (ed >= text.size() || chunks.size() + 1_uz == amount)
+                        {
+                            ed = text.size();
+                        }
+                        else
+                        {
+                            const auto pos = text.find(CharT{ '\n' }, ed - 1_uz);
+                            ed = pos == StringViewType::npos ? text.size() : pos + 1_uz;
+                        }
+                        chunks.push_back(text.substr(bg, ed - bg));
+                        bg = ed;
+                    }
+                    return chunks;
+                }
+
+                inline static StringType unescape(const Cell& cell) noexcept
+                {
+                    if (!cell.escaped)
+                    {
+                        return StringType{ cell.raw };
+                    }
+
+                    StringType ret;
+                    ret.reserve(cell.raw.size());
+                    for (usize i{ 0_uz }; i != cell.raw.size(); ++i)
+                    {
+                        ret.push_back(cell.raw[i]);
+                        if (cell.raw[i] == CharT{ '\"' } && (i + 1_uz) != cell.raw.size() && cell.raw[i + 1_uz] == CharT{ '\"' })
+                        {
+                            ++i;
+                        }
+                    }
+                    return ret;
+                }
+
+            public:
+                // call func(j, cell) for every cell of the line, return the amount of cells
+                template<typename F>
+                    requires std::invocable<F, const usize, const Cell&>
+                inline const usize for_each_cell(const StringViewType line, F&& func) const noexcept
+                {
+                    usize j{ 0_uz };
+                    usize bg{ 0_uz };
+                    usize ed{ 0_uz };
+                    bool escaped{ false };
+                    auto state = State::CellBegin;
+                    usize i{ 0_uz };
+                    while (i != line.size())
+                    {
+                        if (state != State::Quoted && is_seperator(line, i))
+                        {
+                            if (state == State::Unquoted || state == State::CellBegin)
+                            {
+                                ed = i;
+                            }
+                            func(j, Cell{ line.substr(bg, ed - bg), escaped });
+                            ++j;
+                            i += _seperator.size();
+                            bg = i;
+                            ed = i;
+                            escaped = false;
+                            state = State::CellBegin;
+                            continue;
+                        }
+
+                        const auto ch = line[i];
+                        switch (state)
+                        {
+                        case State::CellBegin:
+                            if (ch == CharT{ '\"' })
+                            {
+                                bg = i + 1_uz;
+                                state = State::Quoted;
+                            }
+                            else
+                            {
+                                state = State::Unquoted;
+                            }
+                            break;
+                        case State::Quoted:
+                            if (ch == CharT{ '\"' })
+                            {
+                                ed = i;
+                                state = State::QuoteInQuoted;
+                            }
+                            break;
+                        case State::QuoteInQuoted:
+                            if (ch == CharT{ '\"' })
+                            {
+                                escaped = true;
+                                state = State::Quoted;
+                            }
+                            else
+                            {
+                                state = State::Closed;
+                            }
+                            break;
+                        default:
+                            break;
+                        }
+                        ++i;
+                    }
+
+                    if (state == State::Unquoted || state == State::CellBegin || state == State::Quoted)
+                    {
+                        // an unclosed quote takes the rest of the line
+                        ed = line.size();
+                    }
+                    func(j, Cell{ line.substr(bg, ed - bg), escaped });
+                    return j + 1_uz;
+                }
+
+                inline std::vector<StringType> split(const StringViewType line) const noexcept
+                {
+                    std::vector<StringType> cells;
+                    for_each_cell(line, [&cells](const usize _, const Cell& cell)
+                        {
+                            cells.push_back(unescape(cell));
+                        });
+                    return cells;
+                }
+
+            private:
+                inline const bool is_seperator(const StringViewType line, const usize i) const noexcept
+                {
+                    if (_seperator.size() == 1_uz)
+                    {
+                        return line[i] == _seperator.front();
+                    }
+                    else if (_seperator.empty())
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        return line.substr(i, _seperator.size()) == _seperator;
+                    }
+                }
+
+            private:
+                StringViewType _seperator;
+            };
+        };
+    };
+};
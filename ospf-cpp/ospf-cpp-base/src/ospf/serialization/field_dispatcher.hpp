@@ -0,0 +1,431 @@
+﻿#pragma once
+
+#include <ospf/meta_programming/meta_info.hpp>
+#include <ospf/serialization/nullable.hpp>
+#include <ospf/serialization/writable.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace ospf
+{
+    inline namespace serialization
+    {
+        // owns the dispatchers built for the name transfer of the objects deserialized in it,
+        // a scope with the same transfer as the enclosing one shares its dispatchers,
+        // so that a dispatcher lives as long as the outermost scope of its transfer and is never rebuilt meanwhile
+        class FieldDispatchScope
+        {
+        public:
+            FieldDispatchScope(const void* const transfer) noexcept
+                : _transfer(transfer), _prev(_current)
+            {
+                _owner = (_prev != nullptr && _prev->_transfer == transfer) ? _prev->_owner : this;
+                _current = this;
+            }
+            FieldDispatchScope(const FieldDispatchScope& ano) = delete;
+            FieldDispatchScope(FieldDispatchScope&& ano) = delete;
+            FieldDispatchScope& operator=(const FieldDispatchScope& rhs) = delete;
+            FieldDispatchScope& operator=(FieldDispatchScope&& rhs) = delete;
+
+            ~FieldDispatchScope(void) noexcept
+            {
+                _current = _prev;
+            }
+
+        public:
+            // the dispatcher of the type in this scope, built by builder on the first request
+            template<typename Dispatcher, typename Builder>
+            inline const Dispatcher& dispatcher(const Builder& builder) const noexcept
+            {
+                auto& dispatchers = _owner->_dispatchers;
+                const std::type_index type{ typeid(Dispatcher) };
+                for (const auto& [this_type, dispatcher] : dispatchers)
+                {
+                    if (this_type == type)
+                    {
+                        return *static_cast<const Dispatcher*>(dispatcher.get());
+                    }
+                }
+                dispatchers.emplace_back(type, std::shared_ptr<const void>{ builder() });
+                return *static_cast<const Dispatcher*>(dispatchers.back().second.get());
+            }
+
+        private:
+            inline static thread_local const FieldDispatchScope* _current = nullptr;
+
+            const void* _transfer;
+            const FieldDispatchScope* _prev;
+            const FieldDispatchScope* _owner;
+            mutable std::vector<std::pair<std::type_index, std::shared_ptr<const void>>> _dispatchers;
+        };
+
+        namespace field_dispatcher
+        {
+            inline constexpr const u64 max_displacement = 1_u64 << 12_u64;
+
+            template<typename CharT>
+            inline constexpr const u64 hash(const std::basic_string_view<CharT> name) noexcept
+            {
+                u64 code{ 14695981039346656037_u64 };
+                for (const auto ch : name)
+                {
+                    code ^= static_cast<u64>(ch);
+                    code *= 1099511628211_u64;
+                }
+                return code;
+            }
+
+            inline constexpr const u64 mix(u64 code) noexcept
+            {
+                code ^= code >> 30_u64;
+                code *= 0xbf58476d1ce4e5b9_u64;
+                code ^= code >> 27_u64;
+                code *= 0x94d049bb133111eb_u64;
+                code ^= code >> 31_u64;
+                return code;
+            }
+
+            inline constexpr const usize bucket_amount_of(const usize name_amount) noexcept
+            {
+                return (std::max)(name_amount / 2_uz, 1_uz);
+            }
+
+            inline constexpr const usize bucket_of(const u64 code, const usize bucket_amount) noexcept
+            {
+                return static_cast<usize>((code >> 32_u64) % bucket_amount);
+            }
+
+            inline constexpr const usize slot_of(const u64 code, const u64 displacement, const usize slot_amount) noexcept
+            {
+                return static_cast<usize>(mix(code + displacement * 0x9e3779b97f4a7c15_u64) & (slot_amount - 1_uz));
+            }
+
+            // the names are spread into buckets, and the buckets are placed from the largest one,
+            // each with the first displacement that puts all of its names into free slots
+            inline constexpr const bool place(const std::span<const u64> codes, std::span<u64> displacements, std::span<usize> slots) noexcept
+            {
+                std::fill(slots.begin(), slots.end(), npos);
+                std::fill(displacements.begin(), displacements.end(), 0_u64);
+                std::vector<std::vector<usize>> buckets(displacements.size());
+                for (usize i{ 0_uz }; i != codes.size(); ++i)
+                {
+                    buckets[bucket_of(codes[i], displacements.size())].push_back(i);
+                }
+                std::vector<usize> order(buckets.size());
+                for (usize i{ 0_uz }; i != order.size(); ++i)
+                {
+                    order[i] = i;
+                }
+                std::sort(order.begin(), order.end(), [&buckets](const usize lhs, const usize rhs)
+                    {
+                        return buckets[lhs].size() != buckets[rhs].size() ? buckets[lhs].size() > buckets[rhs].size() : lhs < rhs;
+                    });
+
+                std::vector<usize> this_slots;
+                for (const auto b : order)
+                {
+                    if (buckets[b].empty())
+                    {
+                        break;
+                    }
+
+                    bool placed{ false };
+                    for (u64 displacement{ 0_u64 }; displacement != max_displacement && !placed; ++displacement)
+                    {
+                        this_slots.clear();
+                        placed = true;
+                        for (const auto i : buckets[b])
+                        {
+                            const auto slot = slot_of(codes[i], displacement, slots.size());
+                            if (slots[slot] != npos || std::find(this_slots.cbegin(), this_slots.cend(), slot) != this_slots.cend())
+                            {
+                                placed = false;
+                                break;
+                            }
+                            this_slots.push_back(slot);
+                        }
+                        if (placed)
+                        {
+                            displacements[b] = displacement;
+                            for (usize j{ 0_uz }; j != this_slots.size(); ++j)
+                            {
+                                slots[this_slots[j]] = buckets[b][j];
+                            }
+                        }
+                    }
+                    if (!placed)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            // the least amount of slots that all the names can be placed into, or 0 if none,
+            // the same code of different names can never be placed, they are left to the linear search
+            inline constexpr const usize slot_amount_of(const std::span<const u64> codes) noexcept
+            {
+                if (codes.empty())
+                {
+                    return 0_uz;
+                }
+                std::vector<u64> displacements(bucket_amount_of(codes.size()));
+                const auto max_slot_amount = std::bit_ceil(codes.size() * codes.size() * 4_uz);
+                for (auto slot_amount = std::bit_ceil(codes.size() * 2_uz); slot_amount <= max_slot_amount; slot_amount *= 2_uz)
+                {
+                    std::vector<usize> slots(slot_amount);
+                    if (place(codes, displacements, slots))
+                    {
+                        return slot_amount;
+                    }
+                }
+                return 0_uz;
+            }
+        };
+
+        // maps the names of the writable fields of T after the name transfer to their ordinals in MetaInfo<T>::for_each
+        // with a perfect hash (hash and displace), so that a name is found with one hash and one comparison,
+        // the field of an ordinal is visited through a table of visitors indexed by the ordinal
+        // the table without a transfer is built at compile time, the one of a transfer when it is first requested in a scope
+        // fields with the same name after the transfer are not supported, the first one takes the name
+        template<WithMetaInfo T, CharType CharT>
+        class FieldDispatcher
+        {
+        public:
+            using ValueType = OriginType<T>;
+            using StringType = std::basic_string<CharT>;
+            using StringViewType = std::basic_string_view<CharT>;
+            using NameType = std::pair<StringViewType, usize>;
+
+            static constexpr const meta_info::MetaInfo<ValueType> info{};
+            static constexpr const usize size = info.size();
+
+        private:
+            template<usize name_amount, usize slot_amount>
+            struct Table
+            {
+                std::array<NameType, name_amount> names;
+                std::array<u64, field_dispatcher::bucket_amount_of(name_amount)> displacements;
+                std::array<usize, slot_amount> slots;
+            };
+
+            // the names without a transfer are the keys of the fields
+            inline static constexpr std::pair<std::array<NameType, size>, usize> static_names(void) noexcept
+            {
+                std::array<NameType, size> names{};
+                usize amount{ 0_uz };
+                usize i{ 0_uz };
+                info.for_each([&names, &amount, &i](const auto& field)
+                    {
+                        const auto ordinal = i++;
+                        using FieldValueType = OriginType<decltype(field.value(std::declval<ValueType>()))>;
+                        if constexpr (!field.writable() || !serialization_writable<FieldValueType>)
+                        {
+                            return;
+                        }
+                        else
+                        {
+                            const StringViewType name{ field.key() };
+                            if (std::find_if(names.begin(), names.begin() + amount, [name](const auto& entry) { return entry.first == name; }) == names.begin() + amount)
+                            {
+                                names[amount++] = std::make_pair(name, ordinal);
+                            }
+                        }
+                    });
+                return std::make_pair(names, amount);
+            }
+
+            inline static constexpr std::vector<u64> static_codes(void) noexcept
+            {
+                constexpr const auto names = static_names();
+                std::vector<u64> codes;
+                for (usize i{ 0_uz }; i != names.second; ++i)
+                {
+                    codes.push_back(field_dispatcher::hash(names.first[i].first));
+                }
+                return codes;
+            }
+
+            static constexpr const usize static_name_amount = static_names().second;
+            static constexpr const usize static_slot_amount = field_dispatcher::slot_amount_of(static_codes());
+
+            inline static constexpr Table<static_name_amount, static_slot_amount> static_table(void) noexcept
+            {
+                constexpr const auto names = static_names();
+                Table<static_name_amount, static_slot_amount> table{};
+                std::copy_n(names.first.begin(), static_name_amount, table.names.begin());
+                if constexpr (static_slot_amount != 0_uz)
+                {
+                    field_dispatcher::place(static_codes(), table.displacements, table.slots);
+                }
+                return table;
+            }
+
+            static constexpr const Table<static_name_amount, static_slot_amount> table = static_table();
+
+            FieldDispatcher(void) noexcept
+                : _names(table.names), _displacements(table.displacements), _slots(table.slots) {}
+
+        public:
+            template<typename Transfer>
+            FieldDispatcher(const Transfer& transfer) noexcept
+            {
+                // the views of the names point into the strings, which never move once reserved
+                _name_storage.reserve(size);
+                usize i{ 0_uz };
+                info.for_each([this, &transfer, &i](const auto& field)
+                    {
+                        const auto ordinal = i++;
+                        using FieldValueType = OriginType<decltype(field.value(std::declval<ValueType>()))>;
+                        if constexpr (!field.writable() || !serialization_writable<FieldValueType>)
+                        {
+                            return;
+                        }
+                        else
+                        {
+                            const StringViewType name{ transfer(field.key()) };
+                            if (std::find_if(_name_views.cbegin(), _name_views.cend(), [name](const auto& entry) { return entry.first == name; }) == _name_views.cend())
+                            {
+                                _name_storage.emplace_back(name);
+                                _name_views.push_back(std::make_pair(StringViewType{ _name_storage.back() }, ordinal));
+                            }
+                        }
+                    });
+
+                std::vector<u64> codes;
+                codes.reserve(_name_views.size());
+                for (const auto& entry : _name_views)
+                {
+                    codes.push_back(field_dispatcher::hash(entry.first));
+                }
+                const auto slot_amount = field_dispatcher::slot_amount_of(codes);
+                if (slot_amount != 0_uz)
+                {
+                    _displacement_storage.resize(field_dispatcher::bucket_amount_of(codes.size()));
+                    _slot_storage.resize(slot_amount);
+                    field_dispatcher::place(codes, _displacement_storage, _slot_storage);
+                }
+                _names = _name_views;
+                _displacements = _displacement_storage;
+                _slots = _slot_storage;
+            }
+
+            FieldDispatcher(const FieldDispatcher& ano) = delete;
+            FieldDispatcher(FieldDispatcher&& ano) = delete;
+            FieldDispatcher& operator=(const FieldDispatcher& rhs) = delete;
+            FieldDispatcher& operator=(FieldDispatcher&& rhs) = delete;
+            ~FieldDispatcher(void) noexcept = default;
+
+        public:
+            // the dispatcher of the transfer, the one of a transfer is owned by the scope and lives as long as it
+            template<typename Transfer>
+            inline static const FieldDispatcher& get(const FieldDispatchScope& scope, const std::optional<Transfer>& transfer) noexcept
+            {
+                if (!transfer.has_value())
+                {
+                    static const FieldDispatcher dispatcher{};
+                    return dispatcher;
+                }
+                return scope.dispatcher<FieldDispatcher>([&transfer]()
+                    {
+                        return std::make_unique<const FieldDispatcher>(*transfer);
+                    });
+            }
+
+            template<typename Func>
+            inline static void visit(ValueType& obj, const usize ordinal, const Func& func) noexcept
+            {
+                static constexpr const auto visitors = make_visitors<Func>(std::make_index_sequence<size>{});
+                if (ordinal < size)
+                {
+                    visitors[ordinal](obj, func);
+                }
+            }
+
+            // key of the first writable non-nullable field that is not found
+            inline static std::optional<std::string_view> lost(const std::array<bool, size>& found) noexcept
+            {
+                std::optional<std::string_view> ret;
+                usize i{ 0_uz };
+                info.for_each([&found, &ret, &i](const auto& field)
+                    {
+                        const auto ordinal = i++;
+                        using FieldValueType = OriginType<decltype(field.value(std::declval<ValueType>()))>;
+                        if constexpr (!field.writable() || !serialization_writable<FieldValueType> || serialization_nullable<FieldValueType>)
+                        {
+                            return;
+                        }
+                        else
+                        {
+                            if (!ret.has_value() && !found[ordinal])
+                            {
+                                ret = field.key();
+                            }
+                        }
+                    });
+                return ret;
+            }
+
+        private:
+            template<typename Func>
+            using Visitor = void(*)(ValueType&, const Func&);
+
+            template<typename Func, usize... ordinals>
+            inline static constexpr std::array<Visitor<Func>, size> make_visitors(std::index_sequence<ordinals...>) noexcept
+            {
+                return std::array<Visitor<Func>, size>{ &visit_ordinal<Func, ordinals>... };
+            }
+
+            // the ordinal is a constant in every visitor, so the compiler folds the walk over the field list into the call of its field
+            template<typename Func, usize ordinal>
+            inline static void visit_ordinal(ValueType& obj, const Func& func) noexcept
+            {
+                usize i{ 0_uz };
+                info.for_each(obj, [&func, &i](auto& obj, const auto& field)
+                    {
+                        if (i++ == ordinal)
+                        {
+                            func(obj, field);
+                        }
+                    });
+            }
+
+        public:
+            // ordinal of the field, or npos
+            inline const usize find(const StringViewType name) const noexcept
+            {
+                if (_names.empty())
+                {
+                    return npos;
+                }
+                if (_slots.empty())
+                {
+                    const auto it = std::find_if(_names.begin(), _names.end(), [name](const auto& entry) { return entry.first == name; });
+                    return it != _names.end() ? it->second : npos;
+                }
+                const auto code = field_dispatcher::hash(name);
+                const auto bucket = field_dispatcher::bucket_of(code, _displacements.size());
+                const auto index = _slots[field_dispatcher::slot_of(code, _displacements[bucket], _slots.size())];
+                return (index != npos && _names[index].first == name) ? _names[index].second : npos;
+            }
+
+        private:
+            std::span<const NameType> _names;
+            std::span<const u64> _displacements;
+            std::span<const usize> _slots;
+            std::vector<StringType> _name_storage;
+            std::vector<NameType> _name_views;
+            std::vector<u64> _displacement_storage;
+            std::vector<usize> _slot_storage;
+        };
+    };
+};
@@ -5,3 +5,4 @@
 #include <ospf/serialization/json/serializer.hpp>
 #include <ospf/serialization/json/deserializer.hpp>
 #include <ospf/serialization/json/io.hpp>
+#include <ospf/serialization/json/stream.hpp>
@@ -2,6 +2,7 @@
 
 #include <ospf/serialization/json/from_value.hpp>
 #include <ospf/serialization/json/io.hpp>
+#include <ospf/serialization/json/stream.hpp>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
@@ -63,6 +64,7 @@ namespace ospf
 
                     std::vector<ValueType> ret;
                     static const FromJsonValue<ValueType, CharT> deserializer{};
+                    const FieldDispatchScope scope{ &_transfer };
                     for (const auto& sub_json : json.GetArray())
                     {
                         OSPF_TRY_GET(obj, deserializer(sub_json, _transfer));
@@ -86,6 +88,7 @@ namespace ospf
 
                     std::vector<ValueType> ret;
                     static const FromJsonValue<ValueType, CharT> deserializer{};
+                    const FieldDispatchScope scope{ &_transfer };
                     for (const auto& sub_json : json.GetArray())
                     {
                         ValueType obj{ origin_obj };
@@ -117,10 +120,8 @@ namespace ospf
                 }
 
                 std::basic_ifstream<CharT> fin{ path };
-                OSPF_TRY_GET(doc, read(fin));
-
-                auto deserializer = transfer.has_value() ? Deserializer<T, CharT>{ std::move(transfer).value() } : Deserializer<T, CharT>{};
-                OSPF_TRY_GET(obj, deserializer(doc));
+                auto deserializer = transfer.has_value() ? StreamDeserializer<T, CharT>{ std::move(transfer).value() } : StreamDeserializer<T, CharT>{};
+                OSPF_TRY_GET(obj, deserializer(fin));
                 return std::move(obj);
             }
 
@@ -137,7 +138,7 @@ namespace ospf
 
             template<typename T, CharType CharT = char>
                 requires DeserializableFromJson<T, CharT>
-            inline Result<T> from_file
+            inline Try<> from_file
             (
                 const std::filesystem::path& path,
                 T& obj,
@@ -154,16 +155,14 @@ namespace ospf
                 }
 
                 std::basic_ifstream<CharT> fin{ path };
-                OSPF_TRY_GET(doc, read(fin));
-
-                auto deserializer = transfer.has_value() ? Deserializer<T, CharT>{ std::move(transfer).value() } : Deserializer<T, CharT>{};
-                OSPF_TRY_EXEC(deserializer(doc, obj));
+                auto deserializer = transfer.has_value() ? StreamDeserializer<T, CharT>{ std::move(transfer).value() } : StreamDeserializer<T, CharT>{};
+                OSPF_TRY_EXEC(deserializer(fin, obj));
                 return succeed;
             }
 
             template<typename T, CharType CharT = char>
                 requires DeserializableFromJson<T, CharT>
-            inline Result<T> from_file
+            inline Try<> from_file
             (
                 const std::filesystem::path& path,
                 T& obj,
@@ -191,11 +190,8 @@ namespace ospf
                 }
 
                 std::basic_ifstream<CharT> fin{ path };
-                OSPF_TRY_GET(doc, read(fin));
-                assert(doc.IsArray());
-
-                auto deserializer = transfer.has_value() ? Deserializer<T, CharT>{ std::move(transfer).value() } : Deserializer<T, CharT>{};
-                OSPF_TRY_GET(objs, deserializer.parse_array(doc));
+                auto deserializer = transfer.has_value() ? StreamDeserializer<T, CharT>{ std::move(transfer).value() } : StreamDeserializer<T, CharT>{};
+                OSPF_TRY_GET(objs, deserializer.parse_array(fin));
                 return std::move(objs);
             }
 
@@ -229,11 +225,8 @@ namespace ospf
                 }
 
                 std::basic_ifstream<CharT> fin{ path };
-                OSPF_TRY_GET(doc, read(fin));
-                assert(doc.IsArray());
-
-                auto deserializer = transfer.has_value() ? Deserializer<T, CharT>{ std::move(transfer).value() } : Deserializer<T, CharT>{};
-                OSPF_TRY_GET(objs, deserializer.parse_array(doc, origin_obj));
+                auto deserializer = transfer.has_value() ? StreamDeserializer<T, CharT>{ std::move(transfer).value() } : StreamDeserializer<T, CharT>{};
+                OSPF_TRY_GET(objs, deserializer.parse_array(fin, origin_obj));
                 return std::move(objs);
             }
 
@@ -249,6 +242,43 @@ namespace ospf
                 return from_file_array(path, origin_obj, std::optional<NameTransfer<CharT>>{ std::move(transfer) });
             }
 
+            // hand the elements of the top-level array of the file to func one at a time without keeping them all
+            template<typename T, typename F, CharType CharT = char>
+                requires DeserializableFromJson<T, CharT> && WithDefault<T> && std::invocable<F, T>
+            inline Try<> for_each_from_file
+            (
+                const std::filesystem::path& path,
+                const F& func,
+                std::optional<NameTransfer<CharT>> transfer = NameTransfer<CharT>{ meta_programming::NameTransfer<NamingSystem::SnakeCase, NamingSystem::CamelCase, CharT>{} }
+            ) noexcept
+            {
+                if (!std::filesystem::exists(path))
+                {
+                    return OSPFError{ OSPFErrCode::FileNotFound, std::format("\"{}\" not exist", path.string()) };
+                }
+                if (std::filesystem::is_directory(path))
+                {
+                    return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" is not a file", path.string()) };
+                }
+
+                std::basic_ifstream<CharT> fin{ path };
+                auto deserializer = transfer.has_value() ? StreamDeserializer<T, CharT>{ std::move(transfer).value() } : StreamDeserializer<T, CharT>{};
+                OSPF_TRY_EXEC(deserializer.for_each(fin, func));
+                return succeed;
+            }
+
+            template<typename T, typename F, CharType CharT = char>
+                requires DeserializableFromJson<T, CharT> && WithDefault<T> && std::invocable<F, T>
+            inline Try<> for_each_from_file
+            (
+                const std::filesystem::path& path,
+                const F& func,
+                NameTransfer<CharT> transfer
+            ) noexcept
+            {
+                return for_each_from_file<T, F, CharT>(path, func, std::optional<NameTransfer<CharT>>{ std::move(transfer) });
+            }
+
             template<typename T, CharType CharT = char>
                 requires DeserializableFromJson<T, CharT> && WithDefault<T>
             inline Result<T> from_string
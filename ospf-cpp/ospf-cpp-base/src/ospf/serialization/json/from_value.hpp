@@ -8,6 +8,7 @@
 #include <ospf/meta_programming/meta_info.hpp>
 #include <ospf/meta_programming/variable_type_list.hpp>
 #include <ospf/ospf_base_api.hpp>
+#include <ospf/serialization/field_dispatcher.hpp>
 #include <ospf/serialization/json/concepts.hpp>
 #include <ospf/serialization/nullable.hpp>
 #include <ospf/serialization/writable.hpp>
@@ -100,40 +101,33 @@ namespace ospf
                         return OSPFError{ OSPFErrCode::DeserializationFail, std::format("invlid json for type {}", json, TypeInfo<T>::name()) };
                     }
 
-                    static constexpr const meta_info::MetaInfo<T> info{};
+                    // the members are dispatched to the fields by name, the first one of a duplicated name is taken
+                    using Dispatcher = FieldDispatcher<T, CharT>;
+                    const FieldDispatchScope scope{ &transfer };
+                    const auto& dispatcher = Dispatcher::get(scope, transfer);
+                    std::array<bool, Dispatcher::size> found{};
                     std::optional<OSPFError> err;
-                    info.for_each(obj, [&err, &json, &transfer](auto& obj, const auto& field)
+                    for (const auto& member : json.GetObject())
+                    {
+                        const auto ordinal = dispatcher.find(std::basic_string_view<CharT>{ member.name.GetString(), member.name.GetStringLength() });
+                        if (ordinal == npos || found[ordinal])
                         {
-                            using FieldValueType = OriginType<decltype(field.value(obj))>;
-                            if constexpr (!field.writable() || !serialization_writable<FieldValueType>)
-                            {
-                                return;
-                            }
-                            else
+                            continue;
+                        }
+                        found[ordinal] = true;
+                        Dispatcher::visit(obj, ordinal, [&err, &member, &transfer](auto& obj, const auto& field)
                             {
-                                static_assert(DeserializableFromJson<FieldValueType, CharT>);
-
-                                if (err.has_value())
+                                using FieldValueType = OriginType<decltype(field.value(obj))>;
+                                if constexpr (!field.writable() || !serialization_writable<FieldValueType>)
                                 {
                                     return;
                                 }
-
-                                const auto key = transfer.has_value() ? (*transfer)(field.key()) : field.key();
-                                if (!json.HasMember(key.data()))
-                                {
-                                    if constexpr (serialization_nullable<FieldValueType>)
-                                    {
-                                        return;
-                                    }
-                                    else
-                                    {
-                                        err = OSPFError{ OSPFErrCode::DeserializationFail, std::format("lost non-nullable field \"{}\" for type {}", field.key(), TypeInfo<T>::name()) };
-                                    }
-                                }
                                 else
                                 {
+                                    static_assert(DeserializableFromJson<FieldValueType, CharT>);
+
                                     static const FromJsonValue<FieldValueType, CharT> deserializer{};
-                                    auto value = deserializer(json[key.data()], transfer);
+                                    auto value = deserializer(member.value, transfer);
                                     if constexpr (!serialization_nullable<FieldValueType>)
                                     {
                                         if (value.is_failed())
@@ -147,16 +141,19 @@ namespace ospf
                                         field.value(obj) = std::move(value).unwrap();
                                     }
                                 }
-                            }
-                        });
-                    if (err.has_value())
-                    {
-                        return std::move(err).value();
+                            });
+                        if (err.has_value())
+                        {
+                            return std::move(err).value();
+                        }
                     }
-                    else
+
+                    const auto lost_key = Dispatcher::lost(found);
+                    if (lost_key.has_value())
                     {
-                        return succeed;
+                        return OSPFError{ OSPFErrCode::DeserializationFail, std::format("lost non-nullable field \"{}\" for type {}", *lost_key, TypeInfo<T>::name()) };
                     }
+                    return succeed;
                 }
 
                 template<typename = void>
@@ -2,9 +2,17 @@
 
 #include <ospf/serialization/json/io.hpp>
 #include <ospf/serialization/json/to_value.hpp>
+#include <rapidjson/stringbuffer.h>
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <random>
 #include <sstream>
+#include <system_error>
+
+#ifdef OSPF_MULTI_THREAD
+#include <ospf/parallelism/thread_pool.hpp>
+#endif
 
 namespace ospf
 {
@@ -12,7 +20,78 @@ namespace ospf
     {
         namespace json
         {
-            // todo: impl multi-thread optimization
+            namespace json_detail
+            {
+                // objects formatted into one buffer at a time
+                static constexpr const usize write_chunk_size = 1_uz << 10_uz;
+                // spans with less objects than this are formatted on the calling thread
+                static constexpr const usize parallel_write_threshold = 1_uz << 13_uz;
+
+                template<CharType CharT>
+                inline void flush(std::basic_ostream<CharT>& os, const std::basic_string<CharT>& buffer) noexcept
+                {
+                    os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                }
+
+                // temporary file beside the target with a random suffix, so that concurrent writers of the same target never share one
+                inline std::filesystem::path temp_path_of(const std::filesystem::path& path) noexcept
+                {
+                    thread_local std::mt19937_64 generator{ std::random_device{}() };
+                    std::filesystem::path ret;
+                    do
+                    {
+                        ret = path;
+                        ret += std::format(".{:016x}.tmp", generator());
+                    } while (std::filesystem::exists(ret));
+                    return ret;
+                }
+
+                // the target is written into a temporary file, which replaces the target once the writing succeeds,
+                // so that a failure leaves neither a truncated target nor the temporary file behind
+                template<CharType CharT, typename F>
+                inline Try<> write_file(const std::filesystem::path& path, const F& writer) noexcept
+                {
+                    if (std::filesystem::is_directory(path))
+                    {
+                        return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" is not a file", path.string()) };
+                    }
+
+                    const auto parent_path = path.parent_path();
+                    if (!parent_path.empty() && !std::filesystem::exists(parent_path))
+                    {
+                        std::error_code ec;
+                        if (!std::filesystem::create_directories(parent_path, ec))
+                        {
+                            return OSPFError{ OSPFErrCode::DirectoryUnusable, std::format("directory \"{}\" unusable", parent_path.string()) };
+                        }
+                    }
+
+                    const auto temp_path = temp_path_of(path);
+                    {
+                        std::basic_ofstream<CharT> fout{ temp_path };
+                        auto ret = writer(fout);
+                        fout.close();
+                        if (ret.is_failed() || fout.fail())
+                        {
+                            std::error_code ec;
+                            std::filesystem::remove(temp_path, ec);
+                            if (ret.is_failed())
+                            {
+                                return ret;
+                            }
+                            return OSPFError{ OSPFErrCode::SerializationFail, std::format("failed writing \"{}\"", temp_path.string()) };
+                        }
+                    }
+                    std::error_code ec;
+                    std::filesystem::rename(temp_path, path, ec);
+                    if (ec)
+                    {
+                        std::filesystem::remove(temp_path, ec);
+                        return OSPFError{ OSPFErrCode::SerializationFail, std::format("failed replacing \"{}\"", path.string()) };
+                    }
+                    return succeed;
+                }
+            };
 
             template<typename T, CharType CharT = char>
                 requires SerializableToJson<T, CharT>
@@ -55,6 +134,55 @@ namespace ospf
                     return std::move(doc);
                 }
 
+                // writes the same text as write(os, (*this)(objs)) without building one document for all the objects,
+                // chunks of objects are formatted into their own buffers with their own allocators and written in order,
+                // on worker threads if there are enough of them
+                template<usize len>
+                inline Try<> operator()(const std::span<const ValueType, len> objs, std::basic_ostream<CharT>& os) const noexcept
+                {
+                    std::basic_string<CharT> buffer;
+                    buffer.push_back(CharT{ '[' });
+                    json_detail::flush(os, buffer);
+
+#ifdef OSPF_MULTI_THREAD
+                    if (objs.size() >= json_detail::parallel_write_threshold)
+                    {
+                        auto& pool = ThreadPool::instance();
+                        std::vector<std::basic_string<CharT>> buffers((std::max)(pool.worker_amount(), 1_uz));
+                        const auto batch_size = buffers.size() * json_detail::write_chunk_size;
+                        for (usize bg{ 0_uz }; bg < objs.size(); bg += batch_size)
+                        {
+                            const auto chunk_amount = (std::min)(buffers.size(), (objs.size() - bg + json_detail::write_chunk_size - 1_uz) / json_detail::write_chunk_size);
+                            OSPF_TRY_EXEC(pool.parallel_for(0_uz, chunk_amount, [this, objs, &buffers, bg](const usize k) -> Try<>
+                                {
+                                    const auto this_bg = bg + k * json_detail::write_chunk_size;
+                                    const auto this_ed = (std::min)(this_bg + json_detail::write_chunk_size, objs.size());
+                                    buffers[k].clear();
+                                    return this->append_objects(buffers[k], objs, this_bg, this_ed);
+                                }, 1_uz));
+                            for (usize k{ 0_uz }; k != chunk_amount; ++k)
+                            {
+                                json_detail::flush(os, buffers[k]);
+                            }
+                        }
+                    }
+                    else
+#endif
+                    {
+                        for (usize bg{ 0_uz }; bg < objs.size(); bg += json_detail::write_chunk_size)
+                        {
+                            buffer.clear();
+                            OSPF_TRY_EXEC(append_objects(buffer, objs, bg, (std::min)(bg + json_detail::write_chunk_size, objs.size())));
+                            json_detail::flush(os, buffer);
+                        }
+                    }
+
+                    buffer.clear();
+                    buffer.push_back(CharT{ ']' });
+                    json_detail::flush(os, buffer);
+                    return succeed;
+                }
+
                 inline Result<Json<CharT>> operator()(const ValueType& obj, Document<CharT>& doc) const noexcept
                 {
                     static const ToJsonValue<ValueType, CharT> serializer{};
@@ -75,6 +203,33 @@ namespace ospf
                 }
 
             private:
+                // objects of [bg, ed) in the text of an array, with the comma in front of them except for the first one of the array
+                template<usize len>
+                inline Try<> append_objects(std::basic_string<CharT>& buffer, const std::span<const ValueType, len> objs, const usize bg, const usize ed) const noexcept
+                {
+                    using BufferType = rapidjson::GenericStringBuffer<rapidjson::UTF8<CharT>>;
+
+                    Document<CharT> doc;
+                    BufferType sb;
+                    rapidjson::Writer<BufferType> writer{ sb };
+                    for (usize i{ bg }; i != ed; ++i)
+                    {
+                        if (i != 0_uz)
+                        {
+                            sb.Put(CharT{ ',' });
+                        }
+                        // every object is a root value of its own
+                        writer.Reset(sb);
+                        OSPF_TRY_GET(json, (*this)(objs[i], doc));
+                        if (!json.Accept(writer))
+                        {
+                            return OSPFError{ OSPFErrCode::SerializationFail };
+                        }
+                    }
+                    buffer.append(sb.GetString(), sb.GetSize());
+                    return succeed;
+                }
+
                 template<typename = void>
                     requires WithMetaInfo<ValueType>
                 inline Try<> serialize(Json<CharT>& json, const ValueType& obj, Document<CharT>& doc) const noexcept
@@ -128,26 +283,12 @@ namespace ospf
                 std::optional<NameTransfer<CharT>> transfer = NameTransfer<CharT>{ meta_programming::NameTransfer<NamingSystem::SnakeCase, NamingSystem::CamelCase, CharT>{} }
             ) noexcept
             {
-                if (std::filesystem::is_directory(path))
-                {
-                    return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" is not a file", path.string()) };
-                }
-
-                const auto parent_path = path.parent_path();
-                if (!std::filesystem::exists(parent_path))
-                {
-                    if (!std::filesystem::create_directories(parent_path))
-                    {
-                        return OSPFError{ OSPFErrCode::DirectoryUnusable, std::format("directory \"{}\" unusable", parent_path.string()) };
-                    }
-                }
-
                 auto serializer = transfer.has_value() ? Serializer<T, CharT>{ std::move(transfer).value() } : Serializer<T, CharT>{};
                 OSPF_TRY_GET(doc, serializer(obj));
-
-                std::basic_ofstream<CharT> fout{ path };
-                OSPF_TRY_EXEC(write(fout, doc));
-                return succeed;
+                return json_detail::write_file<CharT>(path, [&doc](std::basic_ofstream<CharT>& fout) -> Try<>
+                    {
+                        return write(fout, doc);
+                    });
             }
 
             template<typename T, CharType CharT = char>
@@ -171,26 +312,12 @@ namespace ospf
                 std::optional<NameTransfer<CharT>> transfer = NameTransfer<CharT>{ meta_programming::NameTransfer<NamingSystem::SnakeCase, NamingSystem::CamelCase, CharT>{} }
             ) noexcept
             {
-                if (std::filesystem::is_directory(path))
-                {
-                    return OSPFError{ OSPFErrCode::NotAFile, std::format("\"{}\" is not a file", path.string()) };
-                }
-
-                const auto parent_path = path.parent_path();
-                if (!std::filesystem::exists(parent_path))
-                {
-                    if (!std::filesystem::create_directories(parent_path))
-                    {
-                        return OSPFError{ OSPFErrCode::DirectoryUnusable, std::format("directory \"{}\" unusable", parent_path.string()) };
-                    }
-                }
-
+                // a failure in a later chunk leaves no truncated file behind
                 auto serializer = transfer.has_value() ? Serializer<T, CharT>{ std::move(transfer).value() } : Serializer<T, CharT>{};
-                OSPF_TRY_GET(doc, serializer(objs));
-
-                std::basic_ofstream<CharT> fout{ path };
-                OSPF_TRY_EXEC(write(fout, doc));
-                return succeed;
+                return json_detail::write_file<CharT>(path, [&serializer, objs](std::basic_ofstream<CharT>& fout) -> Try<>
+                    {
+                        return serializer(objs, fout);
+                    });
             }
 
             template<typename T, usize len, CharType CharT = char>
@@ -218,7 +345,7 @@ namespace ospf
 
                 std::basic_ostringstream<CharT> sout;
                 OSPF_TRY_EXEC(write(sout, doc));
-                return succeed;
+                return sout.str();
             }
 
             template<typename T, CharType CharT = char>
@@ -241,11 +368,9 @@ namespace ospf
             ) noexcept
             {
                 auto serializer = transfer.has_value() ? Serializer<T, CharT>{ std::move(transfer).value() } : Serializer<T, CharT>{};
-                OSPF_TRY_GET(doc, serializer(objs));
-
                 std::basic_ostringstream<CharT> sout;
-                OSPF_TRY_EXEC(write(sout, doc));
-                return succeed;
+                OSPF_TRY_EXEC(serializer(objs, sout));
+                return sout.str();
             }
 
             template<typename T, usize len, CharType CharT = char>
@@ -0,0 +1,583 @@
+﻿#pragma once
+
+#include <ospf/serialization/json/from_value.hpp>
+#include <ospf/serialization/json/io.hpp>
+#include <rapidjson/reader.h>
+#include <array>
+#include <istream>
+#include <string>
+
+namespace ospf
+{
+    inline namespace serialization
+    {
+        namespace json
+        {
+            enum class EventKind : u8
+            {
+                Null,
+                Bool,
+                Int,
+                Uint,
+                Double,
+                String,
+                Key,
+                StartObject,
+                EndObject,
+                StartArray,
+                EndArray
+            };
+
+            // pulls the events of the rapidjson reader one by one from a stream without building a document,
+            // the current event is kept so that the value it starts can be dispatched before it is consumed
+            template<CharType CharT>
+            class EventReader
+            {
+                using ReaderType = rapidjson::GenericReader<rapidjson::UTF8<CharT>, rapidjson::UTF8<CharT>>;
+                using StreamType = rapidjson::BasicIStreamWrapper<std::basic_istream<CharT>>;
+
+                // records every event into the reader, and forwards them into the target document while capturing
+                struct Handler
+                {
+                    EventReader* self;
+                    Document<CharT>* target;
+                    usize depth;
+
+                    inline bool Null(void) noexcept
+                    {
+                        self->_kind = EventKind::Null;
+                        return target == nullptr || target->Null();
+                    }
+
+                    inline bool Bool(const bool value) noexcept
+                    {
+                        self->_kind = EventKind::Bool;
+                        self->_boolean = value;
+                        return target == nullptr || target->Bool(value);
+                    }
+
+                    inline bool Int(const int value) noexcept
+                    {
+                        return Int64(static_cast<int64_t>(value));
+                    }
+
+                    inline bool Uint(const unsigned value) noexcept
+                    {
+                        return Uint64(static_cast<uint64_t>(value));
+                    }
+
+                    inline bool Int64(const int64_t value) noexcept
+                    {
+                        self->_kind = EventKind::Int;
+                        self->_integer = value;
+                        return target == nullptr || target->Int64(value);
+                    }
+
+                    inline bool Uint64(const uint64_t value) noexcept
+                    {
+                        self->_kind = EventKind::Uint;
+                        self->_unsigned_integer = value;
+                        return target == nullptr || target->Uint64(value);
+                    }
+
+                    inline bool Double(const double value) noexcept
+                    {
+                        self->_kind = EventKind::Double;
+                        self->_real = value;
+                        return target == nullptr || target->Double(value);
+                    }
+
+                    inline bool RawNumber(const CharT* str, const rapidjson::SizeType length, const bool copy) noexcept
+                    {
+                        return String(str, length, copy);
+                    }
+
+                    inline bool String(const CharT* str, const rapidjson::SizeType length, const bool copy) noexcept
+                    {
+                        self->_kind = EventKind::String;
+                        self->_str.assign(str, length);
+                        return target == nullptr || target->String(str, length, true);
+                    }
+
+                    inline bool Key(const CharT* str, const rapidjson::SizeType length, const bool copy) noexcept
+                    {
+                        self->_kind = EventKind::Key;
+                        self->_str.assign(str, length);
+                        return target == nullptr || target->Key(str, length, true);
+                    }
+
+                    inline bool StartObject(void) noexcept
+                    {
+                        self->_kind = EventKind::StartObject;
+                        ++depth;
+                        return target == nullptr || target->StartObject();
+                    }
+
+                    inline bool EndObject(const rapidjson::SizeType amount) noexcept
+                    {
+                        self->_kind = EventKind::EndObject;
+                        --depth;
+                        return target == nullptr || target->EndObject(amount);
+                    }
+
+                    inline bool StartArray(void) noexcept
+                    {
+                        self->_kind = EventKind::StartArray;
+                        ++depth;
+                        return target == nullptr || target->StartArray();
+                    }
+
+                    inline bool EndArray(const rapidjson::SizeType amount) noexcept
+                    {
+                        self->_kind = EventKind::EndArray;
+                        --depth;
+                        return target == nullptr || target->EndArray(amount);
+                    }
+                };
+
+            public:
+                EventReader(std::basic_istream<CharT>& is)
+                    : _is(is), _kind(EventKind::Null), _boolean(false), _integer(0_i64), _unsigned_integer(0_u64), _real(0.), _handler{ this, nullptr, 0_uz }
+                {
+                    _reader.IterativeParseInit();
+                }
+                EventReader(const EventReader& ano) = delete;
+                EventReader(EventReader&& ano) = delete;
+                EventReader& operator=(const EventReader& rhs) = delete;
+                EventReader& operator=(EventReader&& rhs) = delete;
+                ~EventReader(void) noexcept = default;
+
+            public:
+                inline const EventKind kind(void) const noexcept
+                {
+                    return _kind;
+                }
+
+                // content of the current string or key event
+                inline const std::basic_string_view<CharT> str(void) const noexcept
+                {
+                    return _str;
+                }
+
+            public:
+                inline Try<> next(void) noexcept
+                {
+                    if (!_reader.template IterativeParseNext<rapidjson::kParseDefaultFlags>(_is, _handler))
+                    {
+                        return parse_error();
+                    }
+                    return succeed;
+                }
+
+                // called once the root value is consumed, the reader only reaches its finish state if nothing but whitespaces follows
+                inline Try<> finish(void) noexcept
+                {
+                    if (!_reader.IterativeParseComplete())
+                    {
+                        OSPF_TRY_EXEC(next());
+                    }
+                    if (!_reader.IterativeParseComplete() || _reader.HasParseError())
+                    {
+                        return OSPFError{ OSPFErrCode::DeserializationFail, "unexpected content behind the root value" };
+                    }
+                    return succeed;
+                }
+
+                // consume the rest of the value started by the current event into doc
+                inline Try<> capture(Document<CharT>& doc) noexcept
+                {
+                    std::optional<OSPFError> err;
+                    auto generator = [this, &err](Document<CharT>& target) -> bool
+                    {
+                        if (!replay(target))
+                        {
+                            err = OSPFError{ OSPFErrCode::DeserializationFail, "expected a json value" };
+                            return false;
+                        }
+                        if (_kind != EventKind::StartObject && _kind != EventKind::StartArray)
+                        {
+                            return true;
+                        }
+
+                        const auto depth = _handler.depth;
+                        _handler.target = &target;
+                        while (_handler.depth >= depth)
+                        {
+                            auto ret = next();
+                            if (ret.is_failed())
+                            {
+                                err = std::move(ret).err();
+                                break;
+                            }
+                        }
+                        _handler.target = nullptr;
+                        return !err.has_value();
+                    };
+                    doc.Populate(generator);
+                    if (err.has_value())
+                    {
+                        return std::move(err).value();
+                    }
+                    return succeed;
+                }
+
+                // consume the rest of the value started by the current event
+                inline Try<> skip(void) noexcept
+                {
+                    if (_kind == EventKind::StartObject || _kind == EventKind::StartArray)
+                    {
+                        const auto depth = _handler.depth;
+                        while (_handler.depth >= depth)
+                        {
+                            OSPF_TRY_EXEC(next());
+                        }
+                    }
+                    return succeed;
+                }
+
+            private:
+                inline const bool replay(Document<CharT>& doc) const noexcept
+                {
+                    switch (_kind)
+                    {
+                    case EventKind::Null:
+                        return doc.Null();
+                    case EventKind::Bool:
+                        return doc.Bool(_boolean);
+                    case EventKind::Int:
+                        return doc.Int64(_integer);
+                    case EventKind::Uint:
+                        return doc.Uint64(_unsigned_integer);
+                    case EventKind::Double:
+                        return doc.Double(_real);
+                    case EventKind::String:
+                        return doc.String(_str.data(), static_cast<rapidjson::SizeType>(_str.size()), true);
+                    case EventKind::StartObject:
+                        return doc.StartObject();
+                    case EventKind::StartArray:
+                        return doc.StartArray();
+                    default:
+                        // keys and ends never start a value
+                        return false;
+                    }
+                }
+
+                inline OSPFError parse_error(void) const noexcept
+                {
+                    if (!_reader.HasParseError())
+                    {
+                        return OSPFError{ OSPFErrCode::DeserializationFail };
+                    }
+                    if constexpr (DecaySameAs<CharT, char>)
+                    {
+                        return OSPFError{ OSPFErrCode::DeserializationFail, std::format("{} at {}", rapidjson::GetParseError_En(_reader.GetParseErrorCode()), _reader.GetErrorOffset()) };
+                    }
+                    else if constexpr (DecaySameAs<CharT, wchar>)
+                    {
+                        return OSPFError{ OSPFErrCode::DeserializationFail, std::format(L"{} at {}", rapidjson::GetParseError_En(_reader.GetParseErrorCode()), _reader.GetErrorOffset()) };
+                    }
+                }
+
+            private:
+                StreamType _is;
+                ReaderType _reader;
+                EventKind _kind;
+                bool _boolean;
+                i64 _integer;
+                u64 _unsigned_integer;
+                f64 _real;
+                std::basic_string<CharT> _str;
+                Handler _handler;
+            };
+
+            // reads the value started by the current event of the reader into obj
+            // types without a specialization are captured into a document of their own and handed to FromJsonValue,
+            // so that only objects with meta info and vectors are streamed
+            template<typename T, CharType CharT>
+            struct FromJsonStream
+            {
+                inline Try<> operator()(EventReader<CharT>& reader, T& obj, const std::optional<NameTransfer<CharT>>& transfer) const noexcept
+                {
+                    Document<CharT> doc;
+                    OSPF_TRY_EXEC(reader.capture(doc));
+                    static const FromJsonValue<T, CharT> deserializer{};
+                    return deserializer(doc, obj, transfer);
+                }
+            };
+
+            template<WithMetaInfo T, CharType CharT>
+            struct FromJsonStream<T, CharT>
+            {
+                inline Try<> operator()(EventReader<CharT>& reader, T& obj, const std::optional<NameTransfer<CharT>>& transfer) const noexcept
+                {
+                    if (reader.kind() == EventKind::Null)
+                    {
+                        if constexpr (serialization_nullable<T>)
+                        {
+                            return succeed;
+                        }
+                        else
+                        {
+                            return OSPFError{ OSPFErrCode::DeserializationFail, std::format("invalid json for type {}", TypeInfo<T>::name()) };
+                        }
+                    }
+                    if (reader.kind() != EventKind::StartObject)
+                    {
+                        return OSPFError{ OSPFErrCode::DeserializationFail, std::format("invalid json for type {}", TypeInfo<T>::name()) };
+                    }
+
+                    using Dispatcher = FieldDispatcher<T, CharT>;
+                    const FieldDispatchScope scope{ &transfer };
+                    const auto& dispatcher = Dispatcher::get(scope, transfer);
+                    std::array<bool, Dispatcher::size> found{};
+                    while (true)
+                    {
+                        OSPF_TRY_EXEC(reader.next());
+                        if (reader.kind() == EventKind::EndObject)
+                        {
+                            break;
+                        }
+
+                        const auto ordinal = dispatcher.find(reader.str());
+                        if (ordinal == npos || found[ordinal])
+                        {
+                            // an unknown key is skipped, and so is a duplicated one, the first one is taken as the document does
+                            OSPF_TRY_EXEC(reader.next());
+                            OSPF_TRY_EXEC(reader.skip());
+                            continue;
+                        }
+                        found[ordinal] = true;
+                        std::optional<OSPFError> err;
+                        Dispatcher::visit(obj, ordinal, [&reader, &transfer, &err](auto& obj, const auto& field)
+                            {
+                                using FieldValueType = OriginType<decltype(field.value(obj))>;
+                                if constexpr (!field.writable() || !serialization_writable<FieldValueType>)
+                                {
+                                    return;
+                                }
+                                else
+                                {
+                                    static_assert(DeserializableFromJson<FieldValueType, CharT>);
+                                    err = read_field<FieldValueType>(reader, obj, field, transfer);
+                                }
+                            });
+                        if (err.has_value())
+                        {
+                            return std::move(err).value();
+                        }
+                    }
+
+                    const auto lost_key = Dispatcher::lost(found);
+                    if (lost_key.has_value())
+                    {
+                        return OSPFError{ OSPFErrCode::DeserializationFail, std::format("lost non-nullable field \"{}\" for type {}", *lost_key, TypeInfo<T>::name()) };
+                    }
+                    return succeed;
+                }
+
+                template<typename = void>
+                    requires WithDefault<T>
+                inline Result<T> operator()(EventReader<CharT>& reader, const std::optional<NameTransfer<CharT>>& transfer) const noexcept
+                {
+                    T obj = DefaultValue<T>::value();
+                    OSPF_TRY_EXEC(this->operator()(reader, obj, transfer));
+                    return std::move(obj);
+                }
+
+            private:
+                template<typename FieldValueType, typename Field>
+                inline static std::optional<OSPFError> read_field(EventReader<CharT>& reader, T& obj, const Field& field, const std::optional<NameTransfer<CharT>>& transfer) noexcept
+                {
+                    auto ret = reader.next();
+                    if (ret.is_failed())
+                    {
+                        return std::move(ret).err();
+                    }
+
+                    if constexpr (serialization_nullable<FieldValueType>)
+                    {
+                        // a nullable field ignores its failures, so it is taken as a whole to keep the reader in place
+                        Document<CharT> doc;
+                        auto captured = reader.capture(doc);
+                        if (captured.is_failed())
+                        {
+                            return std::move(captured).err();
+                        }
+                        static const FromJsonValue<FieldValueType, CharT> deserializer{};
+                        auto value = deserializer(doc, transfer);
+                        if (value.is_succeeded())
+                        {
+                            field.value(obj) = std::move(value).unwrap();
+                        }
+                    }
+                    else
+                    {
+                        static const FromJsonStream<FieldValueType, CharT> deserializer{};
+                        FieldValueType value = DefaultValue<FieldValueType>::value();
+                        auto read = deserializer(reader, value, transfer);
+                        if (read.is_failed())
+                        {
+                            return OSPFError{ OSPFErrCode::DeserializationFail, std::format("failed deserializing field \"{}\" for type {}, {}", field.key(), TypeInfo<T>::name(), read.err().message()) };
+                        }
+                        field.value(obj) = std::move(value);
+                    }
+                    return std::nullopt;
+                }
+            };
+
+            template<typename T, CharType CharT>
+                requires DeserializableFromJson<T, CharT> && WithDefault<T>
+            struct FromJsonStream<std::vector<T>, CharT>
+            {
+                inline Try<> operator()(EventReader<CharT>& reader, std::vector<T>& objs, const std::optional<NameTransfer<CharT>>& transfer) const noexcept
+                {
+                    if (reader.kind() != EventKind::StartArray)
+                    {
+                        return OSPFError{ OSPFErrCode::DeserializationFail, std::format("invalid json for \"{}\"", TypeInfo<std::vector<T>>::name()) };
+                    }
+                    return for_each(reader, transfer, [&objs](T obj) -> Try<>
+                        {
+                            objs.push_back(std::move(obj));
+                            return succeed;
+                        });
+                }
+
+                inline Result<std::vector<T>> operator()(EventReader<CharT>& reader, const std::optional<NameTransfer<CharT>>& transfer) const noexcept
+                {
+                    std::vector<T> objs;
+                    OSPF_TRY_EXEC(this->operator()(reader, objs, transfer));
+                    return std::move(objs);
+                }
+
+                // hand the elements of the array started by the current event to func one at a time, the first failure of func stops the reading
+                template<typename Func>
+                    requires std::invocable<Func, T>
+                inline static Try<> for_each(EventReader<CharT>& reader, const std::optional<NameTransfer<CharT>>& transfer, const Func& func) noexcept
+                {
+                    static const FromJsonStream<OriginType<T>, CharT> deserializer{};
+                    while (true)
+                    {
+                        OSPF_TRY_EXEC(reader.next());
+                        if (reader.kind() == EventKind::EndArray)
+                        {
+                            return succeed;
+                        }
+                        T obj = DefaultValue<T>::value();
+                        OSPF_TRY_EXEC(deserializer(reader, obj, transfer));
+                        OSPF_TRY_EXEC(func(std::move(obj)));
+                    }
+                }
+            };
+
+            // deserializes straight from the events of a stream, the peak memory is the objects themselves
+            // plus the document of the largest value that is not an object with meta info or a vector
+            template<typename T, CharType CharT = char>
+                requires DeserializableFromJson<T, CharT>
+            class StreamDeserializer
+            {
+            public:
+                using ValueType = OriginType<T>;
+
+            public:
+                StreamDeserializer(void) = default;
+                StreamDeserializer(NameTransfer<CharT> transfer)
+                    : _transfer(std::move(transfer)) {}
+                StreamDeserializer(const StreamDeserializer& ano) = default;
+                StreamDeserializer(StreamDeserializer&& ano) noexcept = default;
+                StreamDeserializer& operator=(const StreamDeserializer& rhs) = default;
+                StreamDeserializer& operator=(StreamDeserializer&& rhs) noexcept = default;
+                ~StreamDeserializer(void) noexcept = default;
+
+            public:
+                template<typename = void>
+                    requires WithDefault<ValueType>
+                inline Result<ValueType> operator()(std::basic_istream<CharT>& is) const noexcept
+                {
+                    ValueType obj = DefaultValue<ValueType>::value();
+                    OSPF_TRY_EXEC(this->operator()(is, obj));
+                    return std::move(obj);
+                }
+
+                inline Try<> operator()(std::basic_istream<CharT>& is, ValueType& obj) const noexcept
+                {
+                    static const FromJsonStream<ValueType, CharT> deserializer{};
+                    const FieldDispatchScope scope{ &_transfer };
+                    EventReader<CharT> reader{ is };
+                    OSPF_TRY_EXEC(reader.next());
+                    OSPF_TRY_EXEC(deserializer(reader, obj, _transfer));
+                    return reader.finish();
+                }
+
+                template<typename = void>
+                    requires WithDefault<ValueType>
+                inline Result<std::vector<ValueType>> parse_array(std::basic_istream<CharT>& is) const noexcept
+                {
+                    std::vector<ValueType> ret;
+                    OSPF_TRY_EXEC(for_each(is, [&ret](ValueType obj) -> Try<>
+                        {
+                            ret.push_back(std::move(obj));
+                            return succeed;
+                        }));
+                    return std::move(ret);
+                }
+
+                template<typename = void>
+                    requires std::copyable<ValueType>
+                inline Result<std::vector<ValueType>> parse_array(std::basic_istream<CharT>& is, const ValueType& origin_obj) const noexcept
+                {
+                    static const FromJsonStream<ValueType, CharT> deserializer{};
+                    const FieldDispatchScope scope{ &_transfer };
+                    EventReader<CharT> reader{ is };
+                    OSPF_TRY_EXEC(reader.next());
+                    if (reader.kind() == EventKind::Null)
+                    {
+                        OSPF_TRY_EXEC(reader.finish());
+                        return std::vector<ValueType>{};
+                    }
+                    if (reader.kind() != EventKind::StartArray)
+                    {
+                        return OSPFError{ OSPFErrCode::DeserializationFail, std::format("invalid json for \"{}\"", TypeInfo<std::vector<ValueType>>::name()) };
+                    }
+
+                    std::vector<ValueType> ret;
+                    while (true)
+                    {
+                        OSPF_TRY_EXEC(reader.next());
+                        if (reader.kind() == EventKind::EndArray)
+                        {
+                            break;
+                        }
+                        ValueType obj{ origin_obj };
+                        OSPF_TRY_EXEC(deserializer(reader, obj, _transfer));
+                        ret.push_back(std::move(obj));
+                    }
+                    OSPF_TRY_EXEC(reader.finish());
+                    return std::move(ret);
+                }
+
+                // hand the elements of a top-level array to func one at a time, a null is taken as an empty array as parse_array does
+                template<typename Func>
+                    requires WithDefault<ValueType> && std::invocable<Func, ValueType>
+                inline Try<> for_each(std::basic_istream<CharT>& is, const Func& func) const noexcept
+                {
+                    const FieldDispatchScope scope{ &_transfer };
+                    EventReader<CharT> reader{ is };
+                    OSPF_TRY_EXEC(reader.next());
+                    if (reader.kind() == EventKind::Null)
+                    {
+                        return reader.finish();
+                    }
+                    if (reader.kind() != EventKind::StartArray)
+                    {
+                        return OSPFError{ OSPFErrCode::DeserializationFail, std::format("invalid json for \"{}\"", TypeInfo<std::vector<ValueType>>::name()) };
+                    }
+                    OSPF_TRY_EXEC((FromJsonStream<std::vector<ValueType>, CharT>::for_each(reader, _transfer, func)));
+                    return reader.finish();
+                }
+
+            private:
+                std::optional<NameTransfer<CharT>> _transfer;
+            };
+        };
+    };
+};
@@ -0,0 +1,132 @@
+#include <boost/test/unit_test.hpp>
+#include <ospf/bytes/compaction.hpp>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    // repetitive but not constant, so that every block compresses to something different
+    inline ospf::Bytes<> compaction_input(const ospf::usize size)
+    {
+        using namespace ospf;
+
+        Bytes<> ret;
+        ret.reserve(size);
+        for (usize i{ 0_uz }; i != size; ++i)
+        {
+            ret.push_back(static_cast<ubyte>((i * 7_uz + i / 13_uz) % 251_uz));
+        }
+        return ret;
+    }
+
+    inline ospf::Bytes<> compaction_output(const std::ostringstream& sout)
+    {
+        using namespace ospf;
+
+        const auto str = sout.str();
+        return Bytes<>{ reinterpret_cast<const ubyte*>(str.data()), reinterpret_cast<const ubyte*>(str.data()) + str.size() };
+    }
+
+    // amount of the gzip members, every one starts with the magic number and the deflate method
+    inline ospf::usize gzip_member_amount(const ospf::Bytes<>& bytes)
+    {
+        using namespace ospf;
+
+        usize ret{ 0_uz };
+        for (usize i{ 0_uz }; i + 2_uz < bytes.size(); ++i)
+        {
+            if (bytes[i] == 0x1f && bytes[i + 1_uz] == 0x8b && bytes[i + 2_uz] == 0x08)
+            {
+                ++ret;
+            }
+        }
+        return ret;
+    }
+}
+
+// raw deflate is always streamed through a single filter
+BOOST_AUTO_TEST_CASE(compacter_serial_test)
+{
+    using namespace ospf;
+
+    const auto input = compaction_input(10000_uz);
+    std::ostringstream sout;
+    {
+        Compacter compacter{ sout, Compaction::Deflate, 1024_uz };
+        compacter.put(BytesView<>{ input });
+        BOOST_ASSERT(compacter.finish().is_succeeded());
+    }
+    const auto output = compaction_output(sout);
+    BOOST_ASSERT(!output.empty());
+    auto ret = decompact(BytesView<>{ output }, Compaction::Deflate);
+    BOOST_ASSERT(ret.is_succeeded());
+    BOOST_ASSERT(std::move(ret).unwrap() == input);
+}
+
+// gzip is compressed block by block into the members of a multi-member stream with OSPF_MULTI_THREAD
+BOOST_AUTO_TEST_CASE(compacter_parallel_test)
+{
+    using namespace ospf;
+
+    const auto input = compaction_input(10000_uz);
+    std::ostringstream sout;
+    {
+        Compacter compacter{ sout, Compaction::GZIP, 1024_uz };
+        auto it = compacter.iterator();
+        for (const auto byte : input)
+        {
+            *it = byte;
+            ++it;
+        }
+        BOOST_ASSERT(compacter.finish().is_succeeded());
+    }
+    const auto output = compaction_output(sout);
+#ifdef OSPF_MULTI_THREAD
+    BOOST_ASSERT(gzip_member_amount(output) >= 10_uz);
+#else
+    BOOST_ASSERT(gzip_member_amount(output) >= 1_uz);
+#endif
+    auto ret = decompact(BytesView<>{ output }, Compaction::GZIP);
+    BOOST_ASSERT(ret.is_succeeded());
+    BOOST_ASSERT(std::move(ret).unwrap() == input);
+}
+
+// the members of several rounds of the workers and a partial last block are read back as one stream
+BOOST_AUTO_TEST_CASE(compacter_gunzip_test)
+{
+    using namespace ospf;
+
+    const auto input = compaction_input(100000_uz + 17_uz);
+    std::ostringstream sout;
+    {
+        Compacter compacter{ sout, Compaction::GZIP, 1000_uz };
+        compacter.put(BytesView<>{ input.data(), 50000_uz });
+        compacter.put(BytesView<>{ input.data() + 50000_uz, input.size() - 50000_uz });
+        BOOST_ASSERT(compacter.finish().is_succeeded());
+        BOOST_ASSERT(compacter.finish().is_succeeded());
+    }
+    const auto output = compaction_output(sout);
+    auto ret = decompact(BytesView<>{ output }, Compaction::GZIP);
+    BOOST_ASSERT(ret.is_succeeded());
+    BOOST_ASSERT(std::move(ret).unwrap() == input);
+
+    // an empty input still makes a member, an empty file is not a valid gzip stream
+    std::ostringstream empty_sout;
+    {
+        Compacter compacter{ empty_sout, Compaction::GZIP };
+        BOOST_ASSERT(compacter.finish().is_succeeded());
+    }
+    BOOST_ASSERT(gzip_member_amount(compaction_output(empty_sout)) == 1_uz);
+}
+
+BOOST_AUTO_TEST_CASE(compacter_write_fail_test)
+{
+    using namespace ospf;
+
+    const auto input = compaction_input(4096_uz);
+    std::ostringstream sout;
+    sout.setstate(std::ios_base::badbit);
+    Compacter compacter{ sout, Compaction::GZIP, 1024_uz };
+    compacter.put(BytesView<>{ input });
+    BOOST_ASSERT(compacter.finish().is_failed());
+}
@@ -0,0 +1,97 @@
+#include <boost/test/unit_test.hpp>
+#include <ospf/memory/pool/multi_thread.hpp>
+#include <atomic>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using SlotType = ospf::pool::PoolElementType<int, ospf::on>;
+
+    // underlying pool counting the slots handed out
+    class CountingPool
+    {
+    public:
+        CountingPool(void) = default;
+        CountingPool(const CountingPool& ano) = delete;
+        CountingPool& operator=(const CountingPool& rhs) = delete;
+
+        ~CountingPool(void) noexcept
+        {
+            for (auto slot : _slots)
+            {
+                slot->~SlotType();
+                ::operator delete(slot, std::align_val_t{ alignof(SlotType) });
+            }
+        }
+
+    public:
+        inline SlotType* malloc(void) noexcept
+        {
+            ++allocated;
+            auto slot = static_cast<SlotType*>(::operator new(sizeof(SlotType), std::align_val_t{ alignof(SlotType) }));
+            _slots.push_back(slot);
+            return slot;
+        }
+
+    public:
+        inline static std::atomic<std::size_t> allocated{ 0 };
+
+    private:
+        std::vector<SlotType*> _slots;
+    };
+
+    using PoolType = ospf::pool::ObjectPool<int, CountingPool, ospf::on>;
+
+    void use(PoolType& pool, const int amount)
+    {
+        std::vector<ospf::Unique<int>> objects;
+        for (int i{ 0 }; i != amount; ++i)
+        {
+            objects.push_back(pool.make_unique(i));
+            BOOST_ASSERT(*objects.back() == i);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(cycling_pools_test)
+{
+    // more pools than the entries a thread keeps, so that every pool drops out of the entries of this thread between two uses
+    std::vector<PoolType> pools(PoolType::StateType::max_thread_entry + 8);
+    for (auto& pool : pools)
+    {
+        use(pool, 8);
+    }
+    const auto allocated = CountingPool::allocated.load();
+    for (int round{ 0 }; round != 16; ++round)
+    {
+        for (auto& pool : pools)
+        {
+            use(pool, 8);
+        }
+    }
+    BOOST_ASSERT(CountingPool::allocated.load() == allocated);
+}
+
+BOOST_AUTO_TEST_CASE(exited_threads_test)
+{
+    PoolType pool;
+    std::thread{ [&pool]() { use(pool, 8); } }.join();
+    const auto allocated = CountingPool::allocated.load();
+    for (int round{ 0 }; round != 16; ++round)
+    {
+        // objects of an exited thread freed by another thread
+        std::vector<ospf::Unique<int>> objects;
+        std::thread{ [&pool, &objects]()
+            {
+                use(pool, 8);
+                for (int i{ 0 }; i != 8; ++i)
+                {
+                    objects.push_back(pool.make_unique(i));
+                }
+            } }.join();
+        objects.clear();
+    }
+    BOOST_ASSERT(CountingPool::allocated.load() == allocated);
+}
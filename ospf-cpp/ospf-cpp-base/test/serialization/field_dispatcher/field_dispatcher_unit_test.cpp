@@ -0,0 +1,131 @@
+#include <boost/test/unit_test.hpp>
+#include <ospf/serialization/dto.hpp>
+#include <ospf/serialization/field_dispatcher.hpp>
+#include <array>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+
+struct Box
+{
+    int alpha;
+    int beta;
+    int gamma;
+    int delta;
+    int epsilon;
+    int zeta;
+    int eta;
+    int theta;
+    int iota;
+    int kappa;
+};
+
+OSPF_PLANE_DTO(Box, alpha, beta, gamma, delta, epsilon, zeta, eta, theta, iota, kappa);
+
+struct Point
+{
+    int x;
+    int y;
+};
+
+OSPF_PLANE_DTO(Point, x, y);
+
+namespace
+{
+    using TransferType = std::function<const std::string_view(const std::string_view)>;
+
+    // transfer prefixing the names, the transferred names are kept alive by the storage
+    inline TransferType prefix_transfer(std::string prefix)
+    {
+        return [prefix = std::move(prefix), storage = std::make_shared<std::deque<std::string>>()](const std::string_view name) -> const std::string_view
+        {
+            storage->push_back(prefix + std::string{ name });
+            return storage->back();
+        };
+    }
+
+    const std::array<std::string_view, 10> names{ "alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta", "iota", "kappa" };
+}
+
+BOOST_AUTO_TEST_CASE(static_table_test)
+{
+    using namespace ospf;
+    using Dispatcher = FieldDispatcher<Box, char>;
+
+    const std::optional<TransferType> transfer{ std::nullopt };
+    const FieldDispatchScope scope{ &transfer };
+    const auto& dispatcher = Dispatcher::get(scope, transfer);
+    for (usize i{ 0_uz }; i != names.size(); ++i)
+    {
+        BOOST_ASSERT(dispatcher.find(names[i]) == i);
+    }
+    BOOST_ASSERT(dispatcher.find("") == npos);
+    BOOST_ASSERT(dispatcher.find("lambda") == npos);
+    BOOST_ASSERT(dispatcher.find("alpha_") == npos);
+    BOOST_ASSERT(&Dispatcher::get(scope, transfer) == &dispatcher);
+}
+
+BOOST_AUTO_TEST_CASE(transferred_table_test)
+{
+    using namespace ospf;
+    using Dispatcher = FieldDispatcher<Box, char>;
+
+    const std::optional<TransferType> transfer{ prefix_transfer("p_") };
+    const FieldDispatchScope scope{ &transfer };
+    const auto& dispatcher = Dispatcher::get(scope, transfer);
+    for (usize i{ 0_uz }; i != names.size(); ++i)
+    {
+        BOOST_ASSERT(dispatcher.find(std::string{ "p_" } + std::string{ names[i] }) == i);
+        BOOST_ASSERT(dispatcher.find(names[i]) == npos);
+    }
+    BOOST_ASSERT(&Dispatcher::get(scope, transfer) == &dispatcher);
+}
+
+BOOST_AUTO_TEST_CASE(nested_scope_test)
+{
+    using namespace ospf;
+    using Dispatcher = FieldDispatcher<Box, char>;
+
+    const std::optional<TransferType> outer_transfer{ prefix_transfer("p_") };
+    const std::optional<TransferType> inner_transfer{ prefix_transfer("q_") };
+    const FieldDispatchScope outer_scope{ &outer_transfer };
+    const auto& dispatcher = Dispatcher::get(outer_scope, outer_transfer);
+    {
+        // a scope with the same transfer shares the dispatchers of the enclosing one
+        const FieldDispatchScope same_scope{ &outer_transfer };
+        BOOST_ASSERT(&Dispatcher::get(same_scope, outer_transfer) == &dispatcher);
+
+        // a scope with another transfer builds its own, and leaves the enclosing ones untouched
+        const FieldDispatchScope inner_scope{ &inner_transfer };
+        const auto& inner_dispatcher = Dispatcher::get(inner_scope, inner_transfer);
+        BOOST_ASSERT(&inner_dispatcher != &dispatcher);
+        BOOST_ASSERT(inner_dispatcher.find("q_beta") == 1_uz);
+        BOOST_ASSERT(inner_dispatcher.find("p_beta") == npos);
+        BOOST_ASSERT(FieldDispatcher<Point, char>::get(inner_scope, inner_transfer).find("q_y") == 1_uz);
+    }
+    BOOST_ASSERT(dispatcher.find("p_beta") == 1_uz);
+    BOOST_ASSERT(dispatcher.find("q_beta") == npos);
+}
+
+BOOST_AUTO_TEST_CASE(visit_test)
+{
+    using namespace ospf;
+    using Dispatcher = FieldDispatcher<Box, char>;
+
+    Box box{};
+    for (usize i{ 0_uz }; i != names.size(); ++i)
+    {
+        Dispatcher::visit(box, i, [i](Box& obj, const auto& field)
+            {
+                BOOST_ASSERT(std::string_view{ field.key() } == names[i]);
+                field.value(obj) = static_cast<int>(i) + 1;
+            });
+    }
+    // an ordinal beyond the fields visits nothing
+    Dispatcher::visit(box, names.size(), [](Box& obj, const auto& field)
+        {
+            BOOST_ASSERT(false);
+        });
+    BOOST_ASSERT(box.alpha == 1 && box.epsilon == 5 && box.kappa == 10);
+}
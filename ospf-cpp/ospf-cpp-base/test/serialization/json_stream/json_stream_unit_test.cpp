@@ -0,0 +1,138 @@
+#include <boost/test/unit_test.hpp>
+#include <ospf/serialization/dto.hpp>
+#include <ospf/serialization/json.hpp>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct StreamLine
+{
+    std::string product_name;
+    ospf::i32 amount;
+    std::optional<ospf::f64> unit_price;
+};
+
+OSPF_PLANE_DTO(StreamLine, product_name, amount, unit_price);
+
+struct StreamOrder
+{
+    ospf::u64 order_id;
+    std::string customer;
+    std::vector<StreamLine> lines;
+    std::vector<ospf::i32> tags;
+    std::optional<StreamLine> gift;
+};
+
+OSPF_PLANE_DTO(StreamOrder, order_id, customer, lines, tags, gift);
+
+namespace
+{
+    inline ospf::NameTransfer<char> stream_transfer(void)
+    {
+        using namespace ospf;
+
+        return NameTransfer<char>{ meta_programming::NameTransfer<NamingSystem::SnakeCase, NamingSystem::CamelCase, char>{} };
+    }
+
+    inline const bool same_line(const StreamLine& lhs, const StreamLine& rhs)
+    {
+        return lhs.product_name == rhs.product_name && lhs.amount == rhs.amount && lhs.unit_price == rhs.unit_price;
+    }
+
+    inline const bool same_order(const StreamOrder& lhs, const StreamOrder& rhs)
+    {
+        using namespace ospf;
+
+        if (lhs.order_id != rhs.order_id || lhs.customer != rhs.customer || lhs.tags != rhs.tags
+            || lhs.lines.size() != rhs.lines.size() || lhs.gift.has_value() != rhs.gift.has_value())
+        {
+            return false;
+        }
+        for (usize i{ 0_uz }; i != lhs.lines.size(); ++i)
+        {
+            if (!same_line(lhs.lines[i], rhs.lines[i]))
+            {
+                return false;
+            }
+        }
+        return !lhs.gift.has_value() || same_line(*lhs.gift, *rhs.gift);
+    }
+
+    // unknown members, including nested ones, are skipped by both readers
+    constexpr const std::string_view order_json = R"({
+        "orderId": 42,
+        "customer": "ACME \"North\"",
+        "comment": { "skipped": [1, 2, { "deep": null }] },
+        "lines": [
+            { "productName": "bolt", "amount": 100, "unitPrice": 0.25 },
+            { "productName": "nut", "amount": -3, "unitPrice": null, "extra": "x" }
+        ],
+        "tags": [3, 1, 2],
+        "gift": { "productName": "pen", "amount": 1 }
+    })";
+}
+
+BOOST_AUTO_TEST_CASE(json_stream_object_test)
+{
+    using namespace ospf;
+
+    auto dom = json::from_string<StreamOrder>(order_json, stream_transfer());
+    BOOST_ASSERT(dom.is_succeeded());
+
+    std::istringstream sin{ std::string{ order_json } };
+    const json::StreamDeserializer<StreamOrder> deserializer{ stream_transfer() };
+    auto stream = deserializer(sin);
+    BOOST_ASSERT(stream.is_succeeded());
+
+    const auto dom_order = std::move(dom).unwrap();
+    const auto stream_order = std::move(stream).unwrap();
+    BOOST_ASSERT(same_order(dom_order, stream_order));
+    BOOST_ASSERT(stream_order.lines.size() == 2_uz);
+    BOOST_ASSERT(stream_order.gift.has_value() && stream_order.gift->product_name == "pen");
+}
+
+BOOST_AUTO_TEST_CASE(json_stream_array_test)
+{
+    using namespace ospf;
+
+    const std::string array_json = std::format("[{}, {}, {}]", order_json, order_json, R"({ "orderId": 7, "customer": "", "lines": [], "tags": [] })");
+    auto dom = json::from_string_array<StreamOrder>(std::string_view{ array_json }, stream_transfer());
+    BOOST_ASSERT(dom.is_succeeded());
+
+    std::istringstream sin{ array_json };
+    const json::StreamDeserializer<StreamOrder> deserializer{ stream_transfer() };
+    auto stream = deserializer.parse_array(sin);
+    BOOST_ASSERT(stream.is_succeeded());
+
+    const auto dom_orders = std::move(dom).unwrap();
+    const auto stream_orders = std::move(stream).unwrap();
+    BOOST_ASSERT(dom_orders.size() == 3_uz && stream_orders.size() == 3_uz);
+    for (usize i{ 0_uz }; i != dom_orders.size(); ++i)
+    {
+        BOOST_ASSERT(same_order(dom_orders[i], stream_orders[i]));
+    }
+
+    usize amount{ 0_uz };
+    std::istringstream for_each_sin{ array_json };
+    BOOST_ASSERT(deserializer.for_each(for_each_sin, [&dom_orders, &amount](StreamOrder order) -> Try<>
+        {
+            BOOST_ASSERT(same_order(dom_orders[amount], order));
+            ++amount;
+            return succeed;
+        }).is_succeeded());
+    BOOST_ASSERT(amount == 3_uz);
+}
+
+BOOST_AUTO_TEST_CASE(json_stream_invalid_test)
+{
+    using namespace ospf;
+
+    const json::StreamDeserializer<StreamOrder> deserializer{ stream_transfer() };
+    for (const std::string_view str : { R"(12)", R"({ "orderId": "x" })", R"({ "orderId": 1 )", R"({ "orderId": 1 } 2)" })
+    {
+        std::istringstream sin{ std::string{ str } };
+        BOOST_ASSERT(deserializer(sin).is_failed());
+    }
+}
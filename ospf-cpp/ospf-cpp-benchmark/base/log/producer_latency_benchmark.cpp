@@ -0,0 +1,102 @@
+// latency of the producer side of a multi-thread logger: the time a thread spends in one logging call,
+// measured for every overflow policy and an increasing amount of producer threads,
+// the writer discards the messages, so that it keeps up as fast as the ring allows
+#include <benchmark.hpp>
+#include <ospf/log/string.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace ospf;
+    using Clock = std::chrono::steady_clock;
+    using LoggerType = StringLogger<LogLevel::Trace, on, char>;
+
+    static constexpr const usize record_amount = 1_uz << 18_uz;
+
+    inline const char* policy_name(const LogOverflowPolicy policy) noexcept
+    {
+        switch (policy)
+        {
+        case LogOverflowPolicy::Block:
+            return "block";
+        case LogOverflowPolicy::Drop:
+            return "drop";
+        case LogOverflowPolicy::Spill:
+            return "spill";
+        default:
+            return "unknown";
+        }
+    }
+
+    inline void run(const LogOverflowPolicy policy, const usize thread_amount, const bool with_buffer) noexcept
+    {
+        LoggerType logger{ [](std::ostream&) -> LoggerType::RecordType::Writer
+            {
+                return [](const LoggerType::RecordType::DateTimeType, const LogLevel, const std::string_view) {};
+            }, with_buffer };
+        logger.set_overflow_policy(policy);
+
+        const auto amount = record_amount / thread_amount;
+        std::vector<std::vector<i64>> latencies(thread_amount);
+        std::vector<std::thread> threads;
+        threads.reserve(thread_amount);
+        const auto bg = Clock::now();
+        for (usize i{ 0_uz }; i != thread_amount; ++i)
+        {
+            threads.emplace_back([&logger, &latencies, amount, i]()
+                {
+                    auto& this_latencies = latencies[i];
+                    this_latencies.reserve(amount);
+                    for (usize j{ 0_uz }; j != amount; ++j)
+                    {
+                        const auto this_bg = Clock::now();
+                        logger.log<LogLevel::Info>("thread {} record {} value {}", i, j, static_cast<f64>(j) * 0.5);
+                        this_latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - this_bg).count());
+                    }
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        logger.flush();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - bg).count();
+
+        std::vector<i64> all;
+        all.reserve(record_amount);
+        for (const auto& this_latencies : latencies)
+        {
+            all.insert(all.end(), this_latencies.begin(), this_latencies.end());
+        }
+        std::sort(all.begin(), all.end());
+        const auto percentile = [&all](const f64 p)
+        {
+            return all[(std::min)(all.size() - 1_uz, static_cast<usize>(static_cast<f64>(all.size()) * p))];
+        };
+        std::printf("%-6s %-9s %3zu threads: p50 %6lld ns, p99 %8lld ns, p99.9 %9lld ns, max %10lld ns, total %5lld ms, dropped %zu\n",
+            policy_name(policy), with_buffer ? "buffered" : "unbuffered", thread_amount,
+            static_cast<long long>(percentile(0.5)), static_cast<long long>(percentile(0.99)), static_cast<long long>(percentile(0.999)), static_cast<long long>(all.back()),
+            static_cast<long long>(elapsed), logger.dropped_amount());
+    }
+};
+
+OSPF_BENCHMARK(log_producer_latency)
+{
+    using namespace ospf;
+
+    const auto max_thread_amount = (std::max)(1_uz, static_cast<usize>(std::thread::hardware_concurrency()));
+    for (const auto policy : { LogOverflowPolicy::Block, LogOverflowPolicy::Drop, LogOverflowPolicy::Spill })
+    {
+        for (const auto with_buffer : { true, false })
+        {
+            for (usize thread_amount{ 1_uz }; thread_amount <= max_thread_amount; thread_amount *= 2_uz)
+            {
+                run(policy, thread_amount, with_buffer);
+            }
+        }
+    }
+}
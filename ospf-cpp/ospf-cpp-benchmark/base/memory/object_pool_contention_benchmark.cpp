@@ -0,0 +1,109 @@
+// contention of the multi-thread object pool: every thread allocates a batch of objects and releases it again,
+// for an increasing amount of threads sharing one pool, against the former pool,
+// which took one mutex around the underlying pool on every allocation and every release
+#include <benchmark.hpp>
+#include <ospf/memory/pool.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace ospf;
+
+    static constexpr const usize batch_size = 256_uz;
+    static constexpr const usize round_amount = 4096_uz;
+
+    // about the size of a graph node
+    struct Node
+    {
+        Node(const u64 i)
+            : id(i), weight(static_cast<f64>(i)), neighbours{} {}
+
+        u64 id;
+        f64 weight;
+        std::array<u64, 4_uz> neighbours;
+    };
+
+    // the former multi-thread pool, as it was before the thread caches
+    class MutexPool
+    {
+    public:
+        struct Deleter
+        {
+            inline void operator()(Node* const ptr) const noexcept
+            {
+                std::lock_guard<std::mutex> guard{ pool->_mutex };
+                pool->_pool.destroy(ptr);
+            }
+
+            MutexPool* pool;
+        };
+
+    public:
+        inline std::unique_ptr<Node, Deleter> make_unique(const u64 i) noexcept
+        {
+            std::lock_guard<std::mutex> guard{ _mutex };
+            return std::unique_ptr<Node, Deleter>{ ::new (_pool.malloc()) Node(i), Deleter{ this } };
+        }
+
+    private:
+        std::mutex _mutex;
+        boost::object_pool<Node> _pool;
+    };
+
+    template<typename P>
+    inline void work(P& pool, const usize thread_index) noexcept
+    {
+        using PtrType = decltype(pool.make_unique(0_u64));
+
+        std::vector<PtrType> objects;
+        objects.reserve(batch_size);
+        for (usize i{ 0_uz }; i != round_amount; ++i)
+        {
+            for (usize j{ 0_uz }; j != batch_size; ++j)
+            {
+                objects.push_back(pool.make_unique(static_cast<u64>(thread_index * batch_size + j)));
+            }
+            objects.clear();
+        }
+    }
+
+    template<typename P>
+    inline void run(const char* name, const usize thread_amount) noexcept
+    {
+        P pool;
+        const auto elapsed = benchmark::elapsed_milliseconds([&pool, thread_amount]()
+            {
+                std::vector<std::thread> threads;
+                threads.reserve(thread_amount);
+                for (usize i{ 0_uz }; i != thread_amount; ++i)
+                {
+                    threads.emplace_back([&pool, i]() { work(pool, i); });
+                }
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+            });
+        const auto operation_amount = static_cast<f64>(thread_amount * round_amount * batch_size);
+        std::printf("%-13s %3zu threads: %9.3f ms, %8.2f M allocations and releases per second\n",
+            name, thread_amount, elapsed, operation_amount / elapsed / 1000.);
+    }
+};
+
+OSPF_BENCHMARK(object_pool_contention)
+{
+    using namespace ospf;
+
+    const auto max_thread_amount = (std::max)(1_uz, static_cast<usize>(std::thread::hardware_concurrency()));
+    for (usize thread_amount{ 1_uz }; thread_amount <= max_thread_amount; thread_amount *= 2_uz)
+    {
+        run<ObjectPool<Node, on>>("thread caches", thread_amount);
+        run<MutexPool>("mutex", thread_amount);
+    }
+}
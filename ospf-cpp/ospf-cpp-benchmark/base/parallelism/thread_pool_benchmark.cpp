@@ -0,0 +1,100 @@
+// throughput of small jobs: 10k tasks of a short arithmetic loop, run on the shared thread pool
+// and on std::async, which starts one os thread for every task
+#include <benchmark.hpp>
+#include <ospf/parallelism/thread_pool.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <future>
+#include <vector>
+
+namespace
+{
+    using namespace ospf;
+
+    static constexpr const usize task_amount = 10000_uz;
+    static constexpr const usize round_amount = 5_uz;
+
+    // small enough that the cost of dispatching dominates
+    inline u64 small_task(const usize i) noexcept
+    {
+        u64 ret{ static_cast<u64>(i) };
+        for (usize j{ 0_uz }; j != 256_uz; ++j)
+        {
+            ret = ret * 6364136223846793005_u64 + 1442695040888963407_u64;
+        }
+        return ret;
+    }
+
+    inline const u64 run_pool(void)
+    {
+        auto& pool = parallelism::ThreadPool::instance();
+        std::vector<std::future<u64>> futures;
+        futures.reserve(task_amount);
+        for (usize i{ 0_uz }; i != task_amount; ++i)
+        {
+            futures.push_back(pool.submit([i]() { return small_task(i); }));
+        }
+        u64 ret{ 0_u64 };
+        for (auto& future : futures)
+        {
+            ret ^= pool.wait(future);
+        }
+        return ret;
+    }
+
+    inline const u64 run_parallel_for(void)
+    {
+        auto& pool = parallelism::ThreadPool::instance();
+        std::vector<u64> values(task_amount, 0_u64);
+        (void)pool.parallel_for(0_uz, task_amount, [&values](const usize i)
+            {
+                values[i] = small_task(i);
+            });
+        u64 ret{ 0_u64 };
+        for (const auto value : values)
+        {
+            ret ^= value;
+        }
+        return ret;
+    }
+
+    inline const u64 run_async(void)
+    {
+        std::vector<std::future<u64>> futures;
+        futures.reserve(task_amount);
+        for (usize i{ 0_uz }; i != task_amount; ++i)
+        {
+            futures.push_back(std::async(std::launch::async, [i]() { return small_task(i); }));
+        }
+        u64 ret{ 0_u64 };
+        for (auto& future : futures)
+        {
+            ret ^= future.get();
+        }
+        return ret;
+    }
+
+    template<typename F>
+    inline void run(const char* name, F&& func)
+    {
+        u64 checksum{ 0_u64 };
+        f64 best{ 0. };
+        for (usize i{ 0_uz }; i != round_amount; ++i)
+        {
+            const auto elapsed = benchmark::elapsed_milliseconds([&checksum, &func]() { checksum = func(); });
+            best = i == 0_uz ? elapsed : (std::min)(best, elapsed);
+        }
+        std::printf("%-12s %zu tasks: best %9.3f ms, %8.1f ns per task, checksum %016llx\n",
+            name, task_amount, best, best * 1e6 / static_cast<f64>(task_amount), static_cast<unsigned long long>(checksum));
+    }
+};
+
+OSPF_BENCHMARK(thread_pool_small_tasks)
+{
+    using namespace ospf;
+
+    std::printf("%zu workers\n", parallelism::ThreadPool::instance().worker_amount());
+    run("submit", run_pool);
+    run("parallel_for", run_parallel_for);
+    run("std::async", run_async);
+}
@@ -0,0 +1,90 @@
+// bytes serialization and deserialization of a std::vector<f64> of 100M elements, in both endians:
+// the block path of ToBytesValue / FromBytesValue against the former element by element one,
+// which went through the scalar serializer for every value
+#include <benchmark.hpp>
+#include <ospf/serialization/bytes.hpp>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    using namespace ospf;
+
+    static constexpr const usize element_amount = 100_uz * 1000_uz * 1000_uz;
+
+    inline void serialize_block(const std::vector<f64>& values, Bytes<>& data, const Endian endian) noexcept
+    {
+        static const serialization::bytes::ToBytesValue<std::vector<f64>> serializer{};
+        auto it = data.begin();
+        (void)serializer(values, it, endian);
+    }
+
+    inline void serialize_elements(const std::vector<f64>& values, Bytes<>& data, const Endian endian) noexcept
+    {
+        static const serialization::bytes::ToBytesValue<f64> serializer{};
+        auto it = data.begin();
+        to_bytes<usize>(values.size(), it, endian);
+        for (const auto value : values)
+        {
+            (void)serializer(value, it, endian);
+        }
+    }
+
+    inline void deserialize_block(const Bytes<>& data, std::vector<f64>& values, const Endian endian) noexcept
+    {
+        static const serialization::bytes::FromBytesValue<std::vector<f64>> deserializer{};
+        auto it = data.cbegin();
+        auto ret = deserializer(it, address_length, endian);
+        if (ret.is_succeeded())
+        {
+            values = std::move(ret).unwrap();
+        }
+    }
+
+    inline void deserialize_elements(const Bytes<>& data, std::vector<f64>& values, const Endian endian) noexcept
+    {
+        static const serialization::bytes::FromBytesValue<f64> deserializer{};
+        auto it = data.cbegin();
+        values.resize(from_bytes<usize>(it, endian));
+        for (auto& value : values)
+        {
+            value = deserializer(it, address_length, endian).unwrap();
+        }
+    }
+
+    inline void run(const char* endian_name, const Endian endian, const std::vector<f64>& values)
+    {
+        static const serialization::bytes::ToBytesValue<std::vector<f64>> serializer{};
+        Bytes<> data(serializer.size(values), 0_ub);
+        const auto mega_bytes = static_cast<f64>(data.size()) / static_cast<f64>(1_uz << 20_uz);
+        const auto report = [endian_name, mega_bytes](const char* name, const f64 elapsed)
+        {
+            std::printf("%-6s %-21s %8.1f MB: %9.3f ms, %9.2f MB/s\n", endian_name, name, mega_bytes, elapsed, mega_bytes * 1000. / elapsed);
+        };
+
+        report("serialize block", benchmark::elapsed_milliseconds([&values, &data, endian]() { serialize_block(values, data, endian); }));
+        report("serialize elements", benchmark::elapsed_milliseconds([&values, &data, endian]() { serialize_elements(values, data, endian); }));
+
+        std::vector<f64> block_values;
+        std::vector<f64> element_values;
+        report("deserialize block", benchmark::elapsed_milliseconds([&data, &block_values, endian]() { deserialize_block(data, block_values, endian); }));
+        report("deserialize elements", benchmark::elapsed_milliseconds([&data, &element_values, endian]() { deserialize_elements(data, element_values, endian); }));
+        if (block_values != values || element_values != values)
+        {
+            std::printf("%-6s mismatched values\n", endian_name);
+        }
+    }
+};
+
+OSPF_BENCHMARK(bytes_block_f64_vector)
+{
+    using namespace ospf;
+
+    std::vector<f64> values(element_amount);
+    for (usize i{ 0_uz }; i != element_amount; ++i)
+    {
+        values[i] = static_cast<f64>(i) * 0.25 - 1000.;
+    }
+    run("local", local_endian, values);
+    run("swap", local_endian == Endian::Little ? Endian::Big : Endian::Little, values);
+}
@@ -0,0 +1,87 @@
+// scaling of bytes serialization and deserialization of an array with the amount of segements,
+// for payloads from 1 MB to 2 GB: a single segement, the former fixed 4 segements, and the amount sized by the payload,
+// segements are encoded and decoded in parallel with OSPF_MULTI_THREAD
+#include <benchmark.hpp>
+#include <ospf/serialization/bytes.hpp>
+#include <ospf/serialization/dto.hpp>
+#include <cstdio>
+#include <format>
+#include <span>
+#include <string>
+#include <vector>
+
+struct SegementTask
+{
+    ospf::u64 id;
+    ospf::f64 duration;
+    ospf::i32 priority;
+    std::string name;
+};
+
+OSPF_PLANE_DTO(SegementTask, id, duration, priority, name);
+
+namespace
+{
+    using namespace ospf;
+
+    // about the bytes of an element, an id, a duration, a priority and a name of 11 characters behind its length
+    static constexpr const usize element_bytes = 8_uz + 8_uz + 4_uz + 8_uz + 11_uz;
+
+    inline std::vector<SegementTask> make_tasks(const usize size)
+    {
+        std::vector<SegementTask> ret;
+        const auto amount = size / element_bytes;
+        ret.reserve(amount);
+        for (usize i{ 0_uz }; i != amount; ++i)
+        {
+            ret.push_back(SegementTask{ static_cast<u64>(i), static_cast<f64>(i % 1000_uz) * 0.5, static_cast<i32>(i % 7_uz), std::format("task_{:06}", i % 1000000_uz) });
+        }
+        return ret;
+    }
+
+    inline void run(const char* name, const std::vector<SegementTask>& tasks, const usize segement_bytes)
+    {
+        const std::span<const SegementTask> objs{ tasks };
+        serialization::bytes::Serializer<SegementTask> serializer{};
+        serializer.set_segement_bytes(segement_bytes);
+        const auto segement_size = serialization::bytes::make_header(objs, std::nullopt, local_endian, segement_bytes).segement_size();
+
+        Bytes<> data;
+        const auto serialize_elapsed = benchmark::elapsed_milliseconds([&serializer, &objs, &data]()
+            {
+                auto ret = serializer(objs);
+                if (ret.is_succeeded())
+                {
+                    data = std::move(ret).unwrap();
+                }
+            });
+        usize amount{ 0_uz };
+        const serialization::bytes::Deserializer<SegementTask> deserializer{};
+        const auto deserialize_elapsed = benchmark::elapsed_milliseconds([&deserializer, &data, &amount]()
+            {
+                auto ret = deserializer.parse_array(BytesView<>{ data });
+                amount = ret.is_succeeded() ? std::move(ret).unwrap().size() : 0_uz;
+            });
+
+        const auto mega_bytes = static_cast<f64>(data.size()) / static_cast<f64>(1_uz << 20_uz);
+        std::printf("%-10s %9.1f MB, %4zu segements: serialize %10.3f ms %9.2f MB/s, deserialize %10.3f ms %9.2f MB/s%s\n",
+            name, mega_bytes, segement_size,
+            serialize_elapsed, mega_bytes * 1000. / serialize_elapsed,
+            deserialize_elapsed, mega_bytes * 1000. / deserialize_elapsed,
+            amount == tasks.size() ? "" : ", mismatched");
+    }
+};
+
+OSPF_BENCHMARK(bytes_segement_scaling)
+{
+    using namespace ospf;
+
+    for (const auto size : { 1_uz << 20_uz, 16_uz << 20_uz, 128_uz << 20_uz, 512_uz << 20_uz, 2_uz << 30_uz })
+    {
+        const auto tasks = make_tasks(size);
+        const auto payload = static_cast<usize>(serialization::bytes::make_header(std::span<const SegementTask>{ tasks }, std::nullopt).size());
+        run("single", tasks, payload + 1_uz);
+        run("fixed 4", tasks, (payload + 3_uz) / 4_uz);
+        run("adaptive", tasks, serialization::bytes::Header::default_segement_bytes);
+    }
+}
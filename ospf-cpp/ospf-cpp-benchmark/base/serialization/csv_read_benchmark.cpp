@@ -0,0 +1,118 @@
+// throughput of reading a csv order table into a CSVTable, in MB/s of text:
+// the tokenizer behind csv::read and csv::parse against the former reader,
+// which ran a std::regex over every line, reproduced here as it was
+#include <benchmark.hpp>
+#include <ospf/serialization/csv/io.hpp>
+#include <ospf/string/split.hpp>
+#include <cstdio>
+#include <sstream>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace ospf;
+
+    static constexpr const usize regex_max_size = 8_uz << 20_uz;
+
+    // rows of an order table, every fourth with a quoted cell containing the seperator
+    inline std::string make_text(const usize size)
+    {
+        std::string ret{ "order_id,customer,product,amount,unit_price\n" };
+        ret.reserve(size + 128_uz);
+        for (usize i{ 0_uz }; ret.size() < size; ++i)
+        {
+            ret.append(std::to_string(i));
+            ret.append(i % 4_uz == 0_uz ? ",\"ACME, North\"," : ",customer_");
+            if (i % 4_uz != 0_uz)
+            {
+                ret.append(std::to_string(i % 997_uz));
+                ret.push_back(',');
+            }
+            ret.append("product_");
+            ret.append(std::to_string(i % 131_uz));
+            ret.push_back(',');
+            ret.append(std::to_string(i % 50_uz + 1_uz));
+            ret.push_back(',');
+            ret.append(std::to_string(static_cast<f64>(i % 1000_uz) * 0.25));
+            ret.push_back('\n');
+        }
+        return ret;
+    }
+
+    // the reader before the tokenizer: std::getline, then regex_catch with the catch regex on every line
+    inline Result<CSVTable<char>> regex_read(std::istream& is, const std::string_view seperator = csv::CharTrait<char>::default_seperator)
+    {
+        std::string line;
+        if (!std::getline(is, line))
+        {
+            is.setstate(std::ios_base::failbit);
+            return OSPFError{ OSPFErrCode::DataEmpty };
+        }
+
+        const auto regex_matcher = csv::CharTrait<char>::catch_regex(seperator);
+        std::vector<std::string> header{};
+        auto headers = regex_catch(line, regex_matcher);
+        for (usize j{ 0_uz }; j != headers.size(); ++j)
+        {
+            header.push_back(csv::CharTrait<char>::extract(headers[j], seperator));
+        }
+
+        CSVTable<char> table{ std::span<std::string>{ header } };
+        while (std::getline(is, line))
+        {
+            if (line.empty())
+            {
+                continue;
+            }
+
+            auto this_row = regex_catch(line, regex_matcher);
+            table.insert_row(table.row(), [&this_row, seperator](const usize j)
+                {
+                    return j < this_row.size() ? csv::CharTrait<char>::extract(this_row[j], seperator) : std::string{};
+                });
+        }
+        return std::move(table);
+    }
+
+    template<typename F>
+    inline void run(const char* name, const std::string& text, F&& func)
+    {
+        usize row{ 0_uz };
+        const auto elapsed = benchmark::elapsed_milliseconds([&row, &text, &func]()
+            {
+                auto table = func(text);
+                row = table.is_succeeded() ? std::move(table).unwrap().row() : 0_uz;
+            });
+        const auto mega_bytes = static_cast<f64>(text.size()) / static_cast<f64>(1_uz << 20_uz);
+        std::printf("%-9s %8.1f MB: %9.3f ms, %8.2f MB/s, %zu rows\n", name, mega_bytes, elapsed, mega_bytes * 1000. / elapsed, row);
+    }
+};
+
+OSPF_BENCHMARK(csv_read_throughput)
+{
+    using namespace ospf;
+
+    for (const auto size : { 1_uz << 20_uz, 8_uz << 20_uz, 64_uz << 20_uz, 512_uz << 20_uz })
+    {
+        const auto text = make_text(size);
+        if (size <= regex_max_size)
+        {
+            run("regex", text, [](const std::string& str)
+                {
+                    std::istringstream sin{ str };
+                    return regex_read(sin);
+                });
+        }
+        run("read", text, [](const std::string& str)
+            {
+                std::istringstream sin{ str };
+                return csv::read(sin);
+            });
+        run("parse", text, [](const std::string& str)
+            {
+                return csv::parse(std::string_view{ str });
+            });
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <ospf/basic_definition.hpp>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string_view>
+
+namespace ospf
+{
+    namespace benchmark
+    {
+        using BenchmarkFunction = std::function<void(void)>;
+
+        // benchmarks of the project by their names, run by its main
+        inline std::map<std::string_view, BenchmarkFunction>& benchmarks(void) noexcept
+        {
+            static std::map<std::string_view, BenchmarkFunction> ret;
+            return ret;
+        }
+
+        struct BenchmarkRegistrar
+        {
+            BenchmarkRegistrar(const std::string_view name, BenchmarkFunction function)
+            {
+                benchmarks().emplace(name, std::move(function));
+            }
+        };
+
+        // milliseconds spent in the function
+        template<typename F>
+        inline const f64 elapsed_milliseconds(F&& function)
+        {
+            const auto bg = std::chrono::steady_clock::now();
+            function();
+            return std::chrono::duration<f64, std::milli>{ std::chrono::steady_clock::now() - bg }.count();
+        }
+    };
+};
+
+// defines a benchmark, which is registered to run by the name
+#define OSPF_BENCHMARK(name)\
+static void name##_benchmark(void);\
+static const ::ospf::benchmark::BenchmarkRegistrar name##_benchmark_registrar{ #name, name##_benchmark };\
+static void name##_benchmark(void)
@@ -0,0 +1,31 @@
+#include <benchmark.hpp>
+#include <cstdio>
+
+// runs the benchmarks named by the arguments, or all of them without any
+int main(int argc, char* argv[])
+{
+    using namespace ospf;
+
+    const auto& benchmarks = benchmark::benchmarks();
+    if (argc == 1)
+    {
+        for (const auto& [name, function] : benchmarks)
+        {
+            std::printf("%s\n", name.data());
+            function();
+        }
+        return 0;
+    }
+    for (int i{ 1 }; i != argc; ++i)
+    {
+        const auto it = benchmarks.find(argv[i]);
+        if (it == benchmarks.cend())
+        {
+            std::printf("unknown benchmark \"%s\"\n", argv[i]);
+            return 1;
+        }
+        std::printf("%s\n", it->first.data());
+        it->second();
+    }
+    return 0;
+}
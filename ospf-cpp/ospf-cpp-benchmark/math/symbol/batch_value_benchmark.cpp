@@ -0,0 +1,126 @@
+// evaluation of one sparse objective at a population of candidate points, as in a generation of a heuristic:
+// value at every point one by one against values over the column-major batch,
+// for a linear polynomial, its compiled form and a quadratic polynomial
+#include <benchmark.hpp>
+#include <ospf/math/symbol/compiled/linear.hpp>
+#include <ospf/math/symbol/polynomial/linear.hpp>
+#include <ospf/math/symbol/polynomial/quadratic.hpp>
+#include <ospf/math/symbol/symbol/registry.hpp>
+#include <cstdio>
+#include <format>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace ospf;
+
+    static constexpr const usize dimension = 10000_uz;
+    static constexpr const usize term_amount = 2000_uz;
+    static constexpr const usize point_amount = 512_uz;
+    static constexpr const usize round_amount = 20_uz;
+
+    // the same candidates column-major for the batch and one point after another for the single evaluations
+    struct Population
+    {
+        std::vector<f64> columns;
+        std::vector<std::vector<f64>> points;
+    };
+
+    inline Population make_population(std::mt19937_64& engine)
+    {
+        std::uniform_int_distribution<i64> distribution{ 0_i64, 1_i64 };
+        Population ret{ std::vector<f64>(dimension * point_amount), std::vector<std::vector<f64>>(point_amount, std::vector<f64>(dimension)) };
+        for (usize i{ 0_uz }; i != dimension; ++i)
+        {
+            for (usize j{ 0_uz }; j != point_amount; ++j)
+            {
+                const auto value = static_cast<f64>(distribution(engine));
+                ret.columns[i * point_amount + j] = value;
+                ret.points[j][i] = value;
+            }
+        }
+        return ret;
+    }
+
+    template<typename F>
+    inline void run(const char* name, F&& func)
+    {
+        f64 checksum{ 0. };
+        const auto elapsed = benchmark::elapsed_milliseconds([&checksum, &func]()
+            {
+                for (usize i{ 0_uz }; i != round_amount; ++i)
+                {
+                    for (const auto value : func())
+                    {
+                        checksum += value;
+                    }
+                }
+            }) / static_cast<f64>(round_amount);
+        std::printf("%-26s %zu points: %9.3f ms per population, %8.3f us per point, checksum %.1f\n",
+            name, point_amount, elapsed, elapsed * 1000. / static_cast<f64>(point_amount), checksum);
+    }
+
+    template<typename E>
+    inline std::vector<f64> value_one_by_one(const E& expression, const Population& population) noexcept
+    {
+        std::vector<f64> ret;
+        ret.reserve(point_amount);
+        for (const auto& point : population.points)
+        {
+            ret.push_back(expression.value(std::span<const f64>{ point }).unwrap());
+        }
+        return ret;
+    }
+
+    template<typename E>
+    inline std::vector<f64> value_batch(const E& expression, const Population& population) noexcept
+    {
+        return expression.values(std::span<const f64>{ population.columns }, point_amount).unwrap();
+    }
+};
+
+OSPF_BENCHMARK(symbol_batch_value)
+{
+    using namespace ospf;
+
+    std::vector<PureSymbol> symbols;
+    symbols.reserve(dimension);
+    SymbolRegistry registry{};
+    for (usize i{ 0_uz }; i != dimension; ++i)
+    {
+        symbols.emplace_back(std::format("x{}", i));
+        (void)registry.add(symbols.back());
+    }
+
+    std::mt19937_64 engine{ 42_u64 };
+    std::uniform_int_distribution<usize> index_distribution{ 0_uz, dimension - 1_uz };
+    std::uniform_real_distribution<f64> coefficient_distribution{ -10., 10. };
+
+    using LinearType = LinearPolynomial<f64, f64>;
+    std::vector<typename LinearType::MonomialType> linear_monomials;
+    for (usize k{ 0_uz }; k != term_amount; ++k)
+    {
+        linear_monomials.emplace_back(coefficient_distribution(engine), typename LinearType::MonomialType::CellType{ symbols[index_distribution(engine)] });
+    }
+    const LinearType linear{ std::move(linear_monomials), 1. };
+    const auto compiled_linear = linear.compile().unwrap();
+
+    using QuadraticType = QuadraticPolynomial<f64, f64>;
+    std::vector<typename QuadraticType::MonomialType> quadratic_monomials;
+    for (usize k{ 0_uz }; k != term_amount; ++k)
+    {
+        quadratic_monomials.emplace_back(coefficient_distribution(engine), typename QuadraticType::MonomialType::CellType{ symbols[index_distribution(engine)], symbols[index_distribution(engine)] });
+    }
+    const QuadraticType quadratic{ std::move(quadratic_monomials), 1. };
+
+    const auto population = make_population(engine);
+    run("linear value", [&linear, &population]() { return value_one_by_one(linear, population); });
+    run("linear values", [&linear, &population]() { return value_batch(linear, population); });
+    run("compiled linear value", [&compiled_linear, &population]() { return value_one_by_one(compiled_linear, population); });
+    run("compiled linear values", [&compiled_linear, &population]() { return value_batch(compiled_linear, population); });
+    run("quadratic value", [&quadratic, &population]() { return value_one_by_one(quadratic, population); });
+    run("quadratic values", [&quadratic, &population]() { return value_batch(quadratic, population); });
+}
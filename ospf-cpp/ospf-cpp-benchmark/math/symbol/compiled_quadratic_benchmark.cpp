@@ -0,0 +1,98 @@
+// evaluation of a qubo-like quadratic objective: the object graph of a QuadraticPolynomial,
+// which visits the symbol references of every monomial, against its compiled sparse symmetric form,
+// for the value, the gradient, both at once, and the cost of compiling
+#include <benchmark.hpp>
+#include <ospf/math/symbol/compiled/quadratic.hpp>
+#include <ospf/math/symbol/polynomial/quadratic.hpp>
+#include <ospf/math/symbol/symbol/registry.hpp>
+#include <cstdio>
+#include <format>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace ospf;
+
+    static constexpr const usize dimension = 2000_uz;
+    static constexpr const usize quadratic_term_amount = 100000_uz;
+    static constexpr const usize round_amount = 20_uz;
+
+    template<typename F>
+    inline void run(const char* name, F&& func)
+    {
+        f64 checksum{ 0. };
+        const auto elapsed = benchmark::elapsed_milliseconds([&checksum, &func]()
+            {
+                for (usize i{ 0_uz }; i != round_amount; ++i)
+                {
+                    checksum += func();
+                }
+            }) / static_cast<f64>(round_amount);
+        std::printf("%-29s %9.3f ms, checksum %.1f\n", name, elapsed, checksum);
+    }
+};
+
+OSPF_BENCHMARK(compiled_quadratic_value)
+{
+    using namespace ospf;
+
+    std::vector<PureSymbol> symbols;
+    symbols.reserve(dimension);
+    SymbolRegistry registry{};
+    for (usize i{ 0_uz }; i != dimension; ++i)
+    {
+        symbols.emplace_back(std::format("x{}", i));
+        (void)registry.add(symbols.back());
+    }
+
+    // quadratic terms with duplicated pairs in both orders, and a linear term for every symbol
+    std::mt19937_64 engine{ 42_u64 };
+    std::uniform_int_distribution<usize> index_distribution{ 0_uz, dimension - 1_uz };
+    std::uniform_real_distribution<f64> coefficient_distribution{ -10., 10. };
+    using PolynomialType = QuadraticPolynomial<f64, f64>;
+    using MonomialType = typename PolynomialType::MonomialType;
+    using CellType = typename MonomialType::CellType;
+    std::vector<MonomialType> monomials;
+    monomials.reserve(quadratic_term_amount + dimension);
+    for (usize k{ 0_uz }; k != quadratic_term_amount; ++k)
+    {
+        monomials.emplace_back(coefficient_distribution(engine), CellType{ symbols[index_distribution(engine)], symbols[index_distribution(engine)] });
+    }
+    for (usize i{ 0_uz }; i != dimension; ++i)
+    {
+        monomials.emplace_back(coefficient_distribution(engine), CellType{ symbols[i] });
+    }
+    const PolynomialType polynomial{ std::move(monomials), 1. };
+
+    std::uniform_int_distribution<i64> value_distribution{ 0_i64, 1_i64 };
+    std::vector<f64> values(dimension);
+    for (auto& value : values)
+    {
+        value = static_cast<f64>(value_distribution(engine));
+    }
+    const std::span<const f64> point{ values };
+
+    CompiledQuadraticPolynomial<f64> compiled{};
+    run("compile", [&polynomial, &compiled]()
+        {
+            compiled = polynomial.compile().unwrap();
+            return static_cast<f64>(compiled.columns().size());
+        });
+    std::printf("%zu quadratic terms merged into %zu hessian entries\n", quadratic_term_amount, compiled.columns().size());
+
+    run("object graph value", [&polynomial, point]() { return polynomial.value(point).unwrap(); });
+    run("compiled value", [&compiled, point]() { return compiled.value(point).unwrap(); });
+    run("compiled gradient", [&compiled, point]()
+        {
+            const auto gradient = compiled.gradient(point).unwrap();
+            return gradient.front() + gradient.back();
+        });
+    run("compiled value and gradient", [&compiled, point]()
+        {
+            const auto [value, gradient] = compiled.value_and_gradient(point).unwrap();
+            return value + gradient.front();
+        });
+}
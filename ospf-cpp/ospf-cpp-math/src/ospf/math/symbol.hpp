@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ospf/math/symbol/category.hpp>
+#include <ospf/math/symbol/compiled.hpp>
 
 #include <ospf/math/symbol/symbol.hpp>
 #include <ospf/math/symbol/monomial.hpp>
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <ospf/math/symbol/compiled/linear.hpp>
+#include <ospf/math/symbol/compiled/quadratic.hpp>
+#include <ospf/math/symbol/compiled/incremental.hpp>
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <ospf/math/symbol/compiled/linear.hpp>
+#include <ospf/math/symbol/compiled/quadratic.hpp>
+
+namespace ospf
+{
+    inline namespace math
+    {
+        inline namespace symbol
+        {
+            // keeps the value of a compiled linear polynomial at a point,
+            // the change of a move is got from the coefficient of the moved symbol only
+            template<Invariant T = f64>
+            class IncrementalLinearEvaluator
+            {
+            public:
+                using ValueType = OriginType<T>;
+
+            public:
+                // the point is indexed by the symbol registry
+                inline static Result<IncrementalLinearEvaluator> make(const CompiledLinearPolynomial<ValueType>& polynomial, std::vector<ValueType> point) noexcept
+                {
+                    OSPF_TRY_GET(value, polynomial.value(std::span<const ValueType>{ point }));
+                    return IncrementalLinearEvaluator{ polynomial, std::move(point), std::move(value) };
+                }
+
+            private:
+                IncrementalLinearEvaluator(const CompiledLinearPolynomial<ValueType>& polynomial, std::vector<ValueType> point, ValueType value)
+                    : _polynomial(polynomial), _point(std::move(point)), _coefficients(_point.size(), ArithmeticTrait<ValueType>::zero()), _value(std::move(value))
+                {
+                    for (usize k{ 0_uz }; k != _polynomial.size(); ++k)
+                    {
+                        _coefficients[_polynomial.indices()[k]] = _polynomial.coefficients()[k];
+                    }
+                }
+
+            public:
+                IncrementalLinearEvaluator(const IncrementalLinearEvaluator& ano) = default;
+                IncrementalLinearEvaluator(IncrementalLinearEvaluator&& ano) noexcept = default;
+                IncrementalLinearEvaluator& operator=(const IncrementalLinearEvaluator& rhs) = default;
+                IncrementalLinearEvaluator& operator=(IncrementalLinearEvaluator&& rhs) noexcept = default;
+                ~IncrementalLinearEvaluator(void) noexcept = default;
+
+            public:
+                inline ArgCLRefType<ValueType> value(void) const noexcept
+                {
+                    return _value;
+                }
+
+                inline const std::span<const ValueType> point(void) const noexcept
+                {
+                    return _point;
+                }
+
+                inline const CompiledLinearPolynomial<ValueType>& polynomial(void) const noexcept
+                {
+                    return _polynomial;
+                }
+
+            public:
+                // change of the value if the symbol of the index takes the new value, O(1)
+                inline ValueType delta(const u64 index, ArgCLRefType<ValueType> new_value) const noexcept
+                {
+                    assert(index < _point.size());
+                    return _coefficients[index] * (new_value - _point[index]);
+                }
+
+                inline ValueType delta(const u64 index1, ArgCLRefType<ValueType> new_value1, const u64 index2, ArgCLRefType<ValueType> new_value2) const noexcept
+                {
+                    assert(index1 != index2);
+                    return delta(index1, new_value1) + delta(index2, new_value2);
+                }
+
+                // commits the move, O(1)
+                inline void apply(const u64 index, ArgCLRefType<ValueType> new_value) noexcept
+                {
+                    _value += delta(index, new_value);
+                    _point[index] = new_value;
+                }
+
+                inline void apply(const u64 index1, ArgCLRefType<ValueType> new_value1, const u64 index2, ArgCLRefType<ValueType> new_value2) noexcept
+                {
+                    assert(index1 != index2);
+                    apply(index1, new_value1);
+                    apply(index2, new_value2);
+                }
+
+                // evaluates the value at the point again, dropping the rounding errors accumulated by the moves, O(size)
+                inline void recompute(void) noexcept
+                {
+                    _value = _polynomial.dot(std::span<const ValueType>{ _point });
+                }
+
+            private:
+                CompiledLinearPolynomial<ValueType> _polynomial;
+                std::vector<ValueType> _point;
+                std::vector<ValueType> _coefficients;
+                ValueType _value;
+            };
+
+            // keeps the value of a compiled quadratic polynomial at a point and its partial derivatives without the diagonal terms,
+            // f(x) = 1/2 x^T H x + c^T x + k, g_i = c_i + sum_{j != i} H_ij x_j, q_ii = H_ii / 2,
+            // the change of moving x_i by d is (g_i + q_ii (2 x_i + d)) d, got in O(1),
+            // committing it updates g_j along the row i of the hessian of the polynomial
+            template<Invariant T = f64>
+            class IncrementalQuadraticEvaluator
+            {
+            public:
+                using ValueType = OriginType<T>;
+                using PolynomialType = CompiledQuadraticPolynomial<ValueType>;
+
+            public:
+                // the point is indexed by the symbol registry
+                inline static Result<IncrementalQuadraticEvaluator> make(PolynomialType polynomial, std::vector<ValueType> point) noexcept
+                {
+                    OSPF_TRY_GET(value, polynomial.value(std::span<const ValueType>{ point }));
+                    return IncrementalQuadraticEvaluator{ std::move(polynomial), std::move(point), std::move(value) };
+                }
+
+            private:
+                IncrementalQuadraticEvaluator(PolynomialType polynomial, std::vector<ValueType> point, ValueType value)
+                    : _polynomial(std::move(polynomial)), _point(std::move(point)), _diagonal(_point.size(), ArithmeticTrait<ValueType>::zero()), _fields(_point.size(), ArithmeticTrait<ValueType>::zero()), _value(std::move(value))
+                {
+                    const auto offsets = _polynomial.offsets();
+                    const auto columns = _polynomial.columns();
+                    const auto coefficients = _polynomial.coefficients();
+                    for (usize i{ 0_uz }; i != _polynomial.dimension(); ++i)
+                    {
+                        for (usize k{ offsets[i] }; k != offsets[i + 1_uz]; ++k)
+                        {
+                            if (columns[k] == i)
+                            {
+                                _diagonal[i] = coefficients[k] / (ArithmeticTrait<ValueType>::one() + ArithmeticTrait<ValueType>::one());
+                            }
+                        }
+                    }
+                    init_fields();
+                }
+
+            public:
+                IncrementalQuadraticEvaluator(const IncrementalQuadraticEvaluator& ano) = default;
+                IncrementalQuadraticEvaluator(IncrementalQuadraticEvaluator&& ano) noexcept = default;
+                IncrementalQuadraticEvaluator& operator=(const IncrementalQuadraticEvaluator& rhs) = default;
+                IncrementalQuadraticEvaluator& operator=(IncrementalQuadraticEvaluator&& rhs) noexcept = default;
+                ~IncrementalQuadraticEvaluator(void) noexcept = default;
+
+            public:
+                inline ArgCLRefType<ValueType> value(void) const noexcept
+                {
+                    return _value;
+                }
+
+                inline const std::span<const ValueType> point(void) const noexcept
+                {
+                    return _point;
+                }
+
+                inline const PolynomialType& polynomial(void) const noexcept
+                {
+                    return _polynomial;
+                }
+
+            public:
+                // change of the value if the symbol of the index takes the new value, O(1)
+                inline ValueType delta(const u64 index, ArgCLRefType<ValueType> new_value) const noexcept
+                {
+                    assert(index < _point.size());
+                    const auto diff = new_value - _point[index];
+                    return (_fields[index] + _diagonal[index] * (_point[index] + new_value)) * diff;
+                }
+
+                // change of the value if both symbols take the new values, O(log(degree)) for the product between them
+                inline ValueType delta(const u64 index1, ArgCLRefType<ValueType> new_value1, const u64 index2, ArgCLRefType<ValueType> new_value2) const noexcept
+                {
+                    assert(index1 != index2);
+                    const auto weight = (index1 < _polynomial.dimension() && index2 < _polynomial.dimension()) ? _polynomial.hessian(index1, index2) : ArithmeticTrait<ValueType>::zero();
+                    return delta(index1, new_value1) + delta(index2, new_value2)
+                        + weight * (new_value1 - _point[index1]) * (new_value2 - _point[index2]);
+                }
+
+                // commits the move, O(degree)
+                inline void apply(const u64 index, ArgCLRefType<ValueType> new_value) noexcept
+                {
+                    const auto diff = new_value - _point[index];
+                    _value += delta(index, new_value);
+                    if (index < _polynomial.dimension())
+                    {
+                        const auto offsets = _polynomial.offsets();
+                        const auto columns = _polynomial.columns();
+                        const auto coefficients = _polynomial.coefficients();
+                        for (usize k{ offsets[index] }; k != offsets[index + 1_uz]; ++k)
+                        {
+                            if (columns[k] != index)
+                            {
+                                _fields[columns[k]] += coefficients[k] * diff;
+                            }
+                        }
+                    }
+                    _point[index] = new_value;
+                }
+
+                inline void apply(const u64 index1, ArgCLRefType<ValueType> new_value1, const u64 index2, ArgCLRefType<ValueType> new_value2) noexcept
+                {
+                    assert(index1 != index2);
+                    apply(index1, new_value1);
+                    apply(index2, new_value2);
+                }
+
+                // evaluates the value and the partial derivatives at the point again, dropping the rounding errors accumulated by the moves,
+                // O(size of the polynomial)
+                inline void recompute(void) noexcept
+                {
+                    // the point covers the symbols of the polynomial since it is made
+                    _value = _polynomial.value(std::span<const ValueType>{ _point }).unwrap();
+                    init_fields();
+                }
+
+            private:
+                inline void init_fields(void) noexcept
+                {
+                    std::fill(_fields.begin(), _fields.end(), ArithmeticTrait<ValueType>::zero());
+                    const auto& linear = _polynomial.linear();
+                    for (usize k{ 0_uz }; k != linear.size(); ++k)
+                    {
+                        _fields[linear.indices()[k]] = linear.coefficients()[k];
+                    }
+
+                    const auto offsets = _polynomial.offsets();
+                    const auto columns = _polynomial.columns();
+                    const auto coefficients = _polynomial.coefficients();
+                    for (usize i{ 0_uz }; i != _polynomial.dimension(); ++i)
+                    {
+                        for (usize k{ offsets[i] }; k != offsets[i + 1_uz]; ++k)
+                        {
+                            if (columns[k] != i)
+                            {
+                                _fields[i] += coefficients[k] * _point[columns[k]];
+                            }
+                        }
+                    }
+                }
+
+            private:
+                PolynomialType _polynomial;
+                std::vector<ValueType> _point;
+                std::vector<ValueType> _diagonal;
+                std::vector<ValueType> _fields;
+                ValueType _value;
+            };
+        };
+    };
+};
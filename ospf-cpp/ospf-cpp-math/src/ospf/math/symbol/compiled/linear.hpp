@@ -0,0 +1,236 @@
+#pragma once
+
+#include <ospf/functional/result.hpp>
+#include <ospf/functional/value_or_reference.hpp>
+#include <ospf/math/algebra/concepts/arithmetic.hpp>
+#include <ospf/math/symbol/expression.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <span>
+#include <vector>
+
+namespace ospf
+{
+    inline namespace math
+    {
+        inline namespace symbol
+        {
+            // flat form of a linear expression: the coefficients of the symbols sorted by their indices in the registry,
+            // every symbol appears once, and the expression symbols are inlined
+            template<Invariant T = f64>
+            class CompiledLinearPolynomial
+            {
+            public:
+                using ValueType = OriginType<T>;
+
+            public:
+                constexpr CompiledLinearPolynomial(ArgCLRefType<ValueType> constant = ArithmeticTrait<ValueType>::zero())
+                    : _constant(constant) {}
+
+                constexpr CompiledLinearPolynomial(std::vector<u64> indices, std::vector<ValueType> coefficients, ArgCLRefType<ValueType> constant)
+                    : _indices(std::move(indices)), _coefficients(std::move(coefficients)), _constant(constant)
+                {
+                    assert(_indices.size() == _coefficients.size());
+                    assert(std::is_sorted(_indices.cbegin(), _indices.cend()));
+                }
+
+            public:
+                constexpr CompiledLinearPolynomial(const CompiledLinearPolynomial& ano) = default;
+                constexpr CompiledLinearPolynomial(CompiledLinearPolynomial&& ano) noexcept = default;
+                constexpr CompiledLinearPolynomial& operator=(const CompiledLinearPolynomial& rhs) = default;
+                constexpr CompiledLinearPolynomial& operator=(CompiledLinearPolynomial&& rhs) noexcept = default;
+                constexpr ~CompiledLinearPolynomial(void) noexcept = default;
+
+            public:
+                inline constexpr const usize size(void) const noexcept
+                {
+                    return _indices.size();
+                }
+
+                inline constexpr const std::span<const u64> indices(void) const noexcept
+                {
+                    return _indices;
+                }
+
+                inline constexpr const std::span<const ValueType> coefficients(void) const noexcept
+                {
+                    return _coefficients;
+                }
+
+                inline constexpr ArgCLRefType<ValueType> constant(void) const noexcept
+                {
+                    return _constant;
+                }
+
+            public:
+                // values indexed by the symbol registry, the indices are sorted so that one comparison checks all of them
+                template<Invariant ST>
+                    requires DecaySameAsOrConvertibleTo<ST, ValueType>
+                inline Result<ValueType> value(const std::span<const ST> values) const noexcept
+                {
+                    if (!_indices.empty() && _indices.back() >= values.size())
+                    {
+                        return OSPFError{ OSPFErrCode::ApplicationFail, std::format("value of symbol {} unmatched", _indices.back()) };
+                    }
+                    return dot(values);
+                }
+
+                // values indexed by the symbol registry without checking, the caller ensures that they cover every symbol
+                // four partial sums break the dependency chain of the additions, so that the loop is pipelined and vectorized
+                template<Invariant ST>
+                    requires DecaySameAsOrConvertibleTo<ST, ValueType>
+                inline ValueType dot(const std::span<const ST> values) const noexcept
+                {
+                    const auto n = _indices.size();
+                    const auto* const indices = _indices.data();
+                    const auto* const coefficients = _coefficients.data();
+                    const auto* const xs = values.data();
+
+                    std::array<ValueType, 4_uz> sums{ ArithmeticTrait<ValueType>::zero(), ArithmeticTrait<ValueType>::zero(), ArithmeticTrait<ValueType>::zero(), ArithmeticTrait<ValueType>::zero() };
+                    usize i{ 0_uz };
+                    for (; i + 4_uz <= n; i += 4_uz)
+                    {
+                        sums[0_uz] += coefficients[i] * static_cast<ValueType>(xs[indices[i]]);
+                        sums[1_uz] += coefficients[i + 1_uz] * static_cast<ValueType>(xs[indices[i + 1_uz]]);
+                        sums[2_uz] += coefficients[i + 2_uz] * static_cast<ValueType>(xs[indices[i + 2_uz]]);
+                        sums[3_uz] += coefficients[i + 3_uz] * static_cast<ValueType>(xs[indices[i + 3_uz]]);
+                    }
+                    for (; i != n; ++i)
+                    {
+                        sums[0_uz] += coefficients[i] * static_cast<ValueType>(xs[indices[i]]);
+                    }
+                    return _constant + ((sums[0_uz] + sums[1_uz]) + (sums[2_uz] + sums[3_uz]));
+                }
+
+                // values at a batch of points stored column-major with one column per symbol,
+                // the value of the symbol of index i at point j is points[i * amount + j],
+                // every term adds its coefficient times a contiguous column to the values, which is vectorized
+                template<Invariant ST>
+                    requires DecaySameAsOrConvertibleTo<ST, ValueType>
+                inline Result<std::vector<ValueType>> values(const std::span<const ST> points, const usize amount) const noexcept
+                {
+                    if (amount == 0_uz)
+                    {
+                        return std::vector<ValueType>{};
+                    }
+                    if (points.size() % amount != 0_uz)
+                    {
+                        return OSPFError{ OSPFErrCode::ApplicationFail, std::format("{} values cannot be split into {} points", points.size(), amount) };
+                    }
+                    if (!_indices.empty() && _indices.back() >= points.size() / amount)
+                    {
+                        return OSPFError{ OSPFErrCode::ApplicationFail, std::format("value of symbol {} unmatched", _indices.back()) };
+                    }
+
+                    std::vector<ValueType> ret(amount, _constant);
+                    const auto block_amount = (amount + symbol_detail::batch_block_size - 1_uz) / symbol_detail::batch_block_size;
+#ifdef OSPF_MULTI_THREAD
+                    if (amount >= symbol_detail::parallel_batch_threshold)
+                    {
+                        OSPF_TRY_EXEC(ThreadPool::instance().parallel_for(0_uz, block_amount, [this, points, amount, &ret](const usize block)
+                            {
+                                accumulate(points, amount, ret, block);
+                            }, 1_uz));
+                    }
+                    else
+#endif
+                    {
+                        for (usize block{ 0_uz }; block != block_amount; ++block)
+                        {
+                            accumulate(points, amount, ret, block);
+                        }
+                    }
+                    return std::move(ret);
+                }
+
+            private:
+                // the columns of a block of points stay in the cache while all terms are added
+                template<Invariant ST>
+                inline void accumulate(const std::span<const ST> points, const usize amount, std::vector<ValueType>& ret, const usize block) const noexcept
+                {
+                    const auto bg = block * symbol_detail::batch_block_size;
+                    const auto ed = (std::min)(bg + symbol_detail::batch_block_size, amount);
+                    auto* const ys = ret.data();
+                    for (usize k{ 0_uz }; k != _indices.size(); ++k)
+                    {
+                        const auto coefficient = _coefficients[k];
+                        const auto* const column = points.data() + _indices[k] * amount;
+                        for (usize j{ bg }; j != ed; ++j)
+                        {
+                            ys[j] += coefficient * static_cast<ValueType>(column[j]);
+                        }
+                    }
+                }
+
+            private:
+                std::vector<u64> _indices;
+                std::vector<ValueType> _coefficients;
+                ValueType _constant;
+            };
+
+            // collects the terms of a linear expression, and merges the terms of the same symbol when compiling
+            template<Invariant T = f64>
+            class LinearPolynomialCompiler
+            {
+            public:
+                using ValueType = OriginType<T>;
+
+            public:
+                LinearPolynomialCompiler(void)
+                    : _constant(ArithmeticTrait<ValueType>::zero()) {}
+                LinearPolynomialCompiler(const LinearPolynomialCompiler& ano) = delete;
+                LinearPolynomialCompiler(LinearPolynomialCompiler&& ano) noexcept = default;
+                LinearPolynomialCompiler& operator=(const LinearPolynomialCompiler& rhs) = delete;
+                LinearPolynomialCompiler& operator=(LinearPolynomialCompiler&& rhs) noexcept = default;
+                ~LinearPolynomialCompiler(void) noexcept = default;
+
+            public:
+                inline void add(const u64 index, ArgCLRefType<ValueType> coefficient) noexcept
+                {
+                    _terms.push_back(std::make_pair(index, coefficient));
+                }
+
+                inline void add_constant(ArgCLRefType<ValueType> constant) noexcept
+                {
+                    _constant += constant;
+                }
+
+            public:
+                // terms whose coefficients are cancelled to zero are removed
+                inline CompiledLinearPolynomial<ValueType> compile(void) && noexcept
+                {
+                    std::stable_sort(_terms.begin(), _terms.end(), [](const auto& lhs, const auto& rhs)
+                        {
+                            return lhs.first < rhs.first;
+                        });
+
+                    std::vector<u64> indices;
+                    std::vector<ValueType> coefficients;
+                    indices.reserve(_terms.size());
+                    coefficients.reserve(_terms.size());
+                    for (usize i{ 0_uz }; i != _terms.size();)
+                    {
+                        const auto index = _terms[i].first;
+                        auto coefficient = _terms[i].second;
+                        for (++i; i != _terms.size() && _terms[i].first == index; ++i)
+                        {
+                            coefficient += _terms[i].second;
+                        }
+                        if (coefficient != ArithmeticTrait<ValueType>::zero())
+                        {
+                            indices.push_back(index);
+                            coefficients.push_back(std::move(coefficient));
+                        }
+                    }
+                    _terms.clear();
+                    return CompiledLinearPolynomial<ValueType>{ std::move(indices), std::move(coefficients), _constant };
+                }
+
+            private:
+                std::vector<std::pair<u64, ValueType>> _terms;
+                ValueType _constant;
+            };
+        };
+    };
+};
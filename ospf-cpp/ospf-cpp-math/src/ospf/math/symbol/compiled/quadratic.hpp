@@ -0,0 +1,297 @@
+#pragma once
+
+#include <ospf/math/symbol/compiled/linear.hpp>
+#include <tuple>
+
+namespace ospf
+{
+    inline namespace math
+    {
+        inline namespace symbol
+        {
+            // flat form of a quadratic expression f(x) = 1/2 x^T H x + c^T x + k on the symbol indices of the registry,
+            // the symmetric hessian H is stored as a sparse matrix in compressed rows with both triangles and the diagonal,
+            // the columns of every row are sorted, the linear part c^T x + k is a compiled linear polynomial,
+            // a product q_ij x_i x_j is H_ij = H_ji = q_ij if i != j, and a square q_ii x_i^2 is H_ii = 2 q_ii,
+            // so that x^T H x is always twice the sum of the products and halving it is exact for integers too
+            template<Invariant T = f64>
+            class CompiledQuadraticPolynomial
+            {
+            public:
+                using ValueType = OriginType<T>;
+                using LinearPolynomialType = CompiledLinearPolynomial<ValueType>;
+
+            public:
+                constexpr CompiledQuadraticPolynomial(LinearPolynomialType linear = LinearPolynomialType{})
+                    : _dimension(linear.size() != 0_uz ? static_cast<usize>(linear.indices().back()) + 1_uz : 0_uz), _offsets(_dimension + 1_uz, 0_uz), _linear(std::move(linear)) {}
+
+                constexpr CompiledQuadraticPolynomial(std::vector<usize> offsets, std::vector<u64> columns, std::vector<ValueType> coefficients, LinearPolynomialType linear)
+                    : _dimension(offsets.size() - 1_uz), _offsets(std::move(offsets)), _columns(std::move(columns)), _coefficients(std::move(coefficients)), _linear(std::move(linear))
+                {
+                    assert(_offsets.back() == _columns.size() && _columns.size() == _coefficients.size());
+                    assert(_linear.size() == 0_uz || _linear.indices().back() < _dimension);
+                }
+
+            public:
+                constexpr CompiledQuadraticPolynomial(const CompiledQuadraticPolynomial& ano) = default;
+                constexpr CompiledQuadraticPolynomial(CompiledQuadraticPolynomial&& ano) noexcept = default;
+                constexpr CompiledQuadraticPolynomial& operator=(const CompiledQuadraticPolynomial& rhs) = default;
+                constexpr CompiledQuadraticPolynomial& operator=(CompiledQuadraticPolynomial&& rhs) noexcept = default;
+                constexpr ~CompiledQuadraticPolynomial(void) noexcept = default;
+
+            public:
+                // one more than the largest index of the symbols, 0 if there is no symbol
+                inline constexpr const usize dimension(void) const noexcept
+                {
+                    return _dimension;
+                }
+
+                // the entries of row i of the hessian are [offsets[i], offsets[i + 1])
+                inline constexpr const std::span<const usize> offsets(void) const noexcept
+                {
+                    return _offsets;
+                }
+
+                inline constexpr const std::span<const u64> columns(void) const noexcept
+                {
+                    return _columns;
+                }
+
+                inline constexpr const std::span<const ValueType> coefficients(void) const noexcept
+                {
+                    return _coefficients;
+                }
+
+                // H_ij, O(log(entries of row i))
+                inline const ValueType hessian(const u64 row, const u64 column) const noexcept
+                {
+                    assert(row < _dimension);
+                    const auto bg = _columns.cbegin() + _offsets[row];
+                    const auto ed = _columns.cbegin() + _offsets[row + 1_uz];
+                    const auto it = std::lower_bound(bg, ed, column);
+                    return (it != ed && *it == column) ? _coefficients[it - _columns.cbegin()] : ArithmeticTrait<ValueType>::zero();
+                }
+
+                inline constexpr const LinearPolynomialType& linear(void) const noexcept
+                {
+                    return _linear;
+                }
+
+                inline constexpr ArgCLRefType<ValueType> constant(void) const noexcept
+                {
+                    return _linear.constant();
+                }
+
+            public:
+                // values indexed by the symbol registry
+                template<Invariant ST>
+                    requires DecaySameAsOrConvertibleTo<ST, ValueType>
+                inline Result<ValueType> value(const std::span<const ST> values) const noexcept
+                {
+                    OSPF_TRY_EXEC(check(values));
+                    auto ret = ArithmeticTrait<ValueType>::zero();
+                    for (usize i{ 0_uz }; i != _dimension; ++i)
+                    {
+                        ret += static_cast<ValueType>(values[i]) * row_dot(i, values);
+                    }
+                    return ret / (ArithmeticTrait<ValueType>::one() + ArithmeticTrait<ValueType>::one()) + _linear.dot(values);
+                }
+
+                // H x + c
+                template<Invariant ST>
+                    requires DecaySameAsOrConvertibleTo<ST, ValueType>
+                inline Result<std::vector<ValueType>> gradient(const std::span<const ST> values) const noexcept
+                {
+                    OSPF_TRY_EXEC(check(values));
+                    std::vector<ValueType> ret(_dimension);
+                    for (usize i{ 0_uz }; i != _dimension; ++i)
+                    {
+                        ret[i] = row_dot(i, values);
+                    }
+                    add_linear(ret);
+                    return std::move(ret);
+                }
+
+                // the value and the gradient share the product H x
+                template<Invariant ST>
+                    requires DecaySameAsOrConvertibleTo<ST, ValueType>
+                inline Result<std::pair<ValueType, std::vector<ValueType>>> value_and_gradient(const std::span<const ST> values) const noexcept
+                {
+                    OSPF_TRY_EXEC(check(values));
+                    auto value = ArithmeticTrait<ValueType>::zero();
+                    std::vector<ValueType> gradient(_dimension);
+                    for (usize i{ 0_uz }; i != _dimension; ++i)
+                    {
+                        gradient[i] = row_dot(i, values);
+                        value += static_cast<ValueType>(values[i]) * gradient[i];
+                    }
+                    value = value / (ArithmeticTrait<ValueType>::one() + ArithmeticTrait<ValueType>::one()) + _linear.dot(values);
+                    add_linear(gradient);
+                    return std::make_pair(std::move(value), std::move(gradient));
+                }
+
+            private:
+                template<Invariant ST>
+                inline Try<> check(const std::span<const ST> values) const noexcept
+                {
+                    if (_dimension > values.size())
+                    {
+                        return OSPFError{ OSPFErrCode::ApplicationFail, std::format("{} values for {} symbols", values.size(), _dimension) };
+                    }
+                    return succeed;
+                }
+
+                // (H x)_i
+                template<Invariant ST>
+                inline ValueType row_dot(const usize row, const std::span<const ST> values) const noexcept
+                {
+                    const auto* const columns = _columns.data();
+                    const auto* const coefficients = _coefficients.data();
+                    const auto* const xs = values.data();
+                    auto ret = ArithmeticTrait<ValueType>::zero();
+                    for (usize k{ _offsets[row] }; k != _offsets[row + 1_uz]; ++k)
+                    {
+                        ret += coefficients[k] * static_cast<ValueType>(xs[columns[k]]);
+                    }
+                    return ret;
+                }
+
+                inline void add_linear(std::vector<ValueType>& gradient) const noexcept
+                {
+                    for (usize k{ 0_uz }; k != _linear.size(); ++k)
+                    {
+                        gradient[_linear.indices()[k]] += _linear.coefficients()[k];
+                    }
+                }
+
+            private:
+                usize _dimension;
+                std::vector<usize> _offsets;
+                std::vector<u64> _columns;
+                std::vector<ValueType> _coefficients;
+                LinearPolynomialType _linear;
+            };
+
+            // collects the terms of a quadratic expression, and merges the terms of the same product when compiling
+            template<Invariant T = f64>
+            class QuadraticPolynomialCompiler
+            {
+            public:
+                using ValueType = OriginType<T>;
+
+            public:
+                QuadraticPolynomialCompiler(void) = default;
+                QuadraticPolynomialCompiler(const QuadraticPolynomialCompiler& ano) = delete;
+                QuadraticPolynomialCompiler(QuadraticPolynomialCompiler&& ano) noexcept = default;
+                QuadraticPolynomialCompiler& operator=(const QuadraticPolynomialCompiler& rhs) = delete;
+                QuadraticPolynomialCompiler& operator=(QuadraticPolynomialCompiler&& rhs) noexcept = default;
+                ~QuadraticPolynomialCompiler(void) noexcept = default;
+
+            public:
+                inline void add(const u64 index1, const u64 index2, ArgCLRefType<ValueType> coefficient) noexcept
+                {
+                    _terms.push_back(std::make_tuple((std::min)(index1, index2), (std::max)(index1, index2), coefficient));
+                }
+
+                inline void add(const u64 index, ArgCLRefType<ValueType> coefficient) noexcept
+                {
+                    _linear.add(index, coefficient);
+                }
+
+                inline void add_constant(ArgCLRefType<ValueType> constant) noexcept
+                {
+                    _linear.add_constant(constant);
+                }
+
+                // adds the product of two linear forms multiplied by the coefficient
+                inline void add(const CompiledLinearPolynomial<ValueType>& lhs, const CompiledLinearPolynomial<ValueType>& rhs, ArgCLRefType<ValueType> coefficient) noexcept
+                {
+                    for (usize i{ 0_uz }; i != lhs.size(); ++i)
+                    {
+                        for (usize j{ 0_uz }; j != rhs.size(); ++j)
+                        {
+                            add(lhs.indices()[i], rhs.indices()[j], coefficient * lhs.coefficients()[i] * rhs.coefficients()[j]);
+                        }
+                        add(lhs.indices()[i], coefficient * lhs.coefficients()[i] * rhs.constant());
+                    }
+                    for (usize j{ 0_uz }; j != rhs.size(); ++j)
+                    {
+                        add(rhs.indices()[j], coefficient * lhs.constant() * rhs.coefficients()[j]);
+                    }
+                    add_constant(coefficient * lhs.constant() * rhs.constant());
+                }
+
+            public:
+                // terms whose coefficients are cancelled to zero are removed
+                inline CompiledQuadraticPolynomial<ValueType> compile(void) && noexcept
+                {
+                    std::stable_sort(_terms.begin(), _terms.end(), [](const auto& lhs, const auto& rhs)
+                        {
+                            return std::make_pair(std::get<0_uz>(lhs), std::get<1_uz>(lhs)) < std::make_pair(std::get<0_uz>(rhs), std::get<1_uz>(rhs));
+                        });
+
+                    // merge the products of the same pair, and count the entries of every row of the hessian
+                    std::vector<std::tuple<u64, u64, ValueType>> terms;
+                    auto linear = std::move(_linear).compile();
+                    usize dimension = linear.size() != 0_uz ? static_cast<usize>(linear.indices().back()) + 1_uz : 0_uz;
+                    for (usize i{ 0_uz }; i != _terms.size();)
+                    {
+                        const auto row = std::get<0_uz>(_terms[i]);
+                        const auto column = std::get<1_uz>(_terms[i]);
+                        auto coefficient = std::get<2_uz>(_terms[i]);
+                        for (++i; i != _terms.size() && std::get<0_uz>(_terms[i]) == row && std::get<1_uz>(_terms[i]) == column; ++i)
+                        {
+                            coefficient += std::get<2_uz>(_terms[i]);
+                        }
+                        if (coefficient != ArithmeticTrait<ValueType>::zero())
+                        {
+                            terms.push_back(std::make_tuple(row, column, std::move(coefficient)));
+                            dimension = (std::max)(dimension, static_cast<usize>(column) + 1_uz);
+                        }
+                    }
+
+                    std::vector<usize> offsets(dimension + 1_uz, 0_uz);
+                    for (const auto& [row, column, coefficient] : terms)
+                    {
+                        ++offsets[row + 1_uz];
+                        if (row != column)
+                        {
+                            ++offsets[column + 1_uz];
+                        }
+                    }
+                    for (usize i{ 0_uz }; i != dimension; ++i)
+                    {
+                        offsets[i + 1_uz] += offsets[i];
+                    }
+
+                    // the products are sorted by (i, j) with i <= j, so the columns of every row are filled in ascending order:
+                    // the ones less than it from the upper triangle first, then the diagonal, and then the ones greater than it
+                    std::vector<u64> columns(offsets.back());
+                    std::vector<ValueType> coefficients(offsets.back());
+                    std::vector<usize> positions{ offsets.cbegin(), offsets.cend() - 1_iz };
+                    for (const auto& [row, column, coefficient] : terms)
+                    {
+                        if (row == column)
+                        {
+                            columns[positions[row]] = column;
+                            coefficients[positions[row]++] = coefficient + coefficient;
+                        }
+                        else
+                        {
+                            columns[positions[row]] = column;
+                            coefficients[positions[row]++] = coefficient;
+                            columns[positions[column]] = row;
+                            coefficients[positions[column]++] = coefficient;
+                        }
+                    }
+                    _terms.clear();
+                    return CompiledQuadraticPolynomial<ValueType>{ std::move(offsets), std::move(columns), std::move(coefficients), std::move(linear) };
+                }
+
+            private:
+                std::vector<std::tuple<u64, u64, ValueType>> _terms;
+                LinearPolynomialCompiler<ValueType> _linear;
+            };
+        };
+    };
+};
@@ -4,6 +4,16 @@
 #include <ospf/functional/value_or_reference.hpp>
 #include <ospf/math/algebra/concepts/real_number.hpp>
 #include <ospf/math/symbol/category.hpp>
+#include <ospf/meta_programming/type_info.hpp>
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <vector>
+
+#ifdef OSPF_MULTI_THREAD
+#include <ospf/parallelism/thread_pool.hpp>
+#endif
 
 namespace ospf
 {
@@ -11,6 +21,47 @@ namespace ospf
     {
         inline namespace symbol
         {
+            namespace symbol_detail
+            {
+                // a batch of points is evaluated in blocks of so many points,
+                // a multiple of the word size of std::vector<bool>, so that threads never write to the same word
+                static constexpr const usize batch_block_size = 1_uz << 8_uz;
+                // a batch with fewer points than this is not split among threads
+                static constexpr const usize parallel_batch_threshold = 1_uz << 10_uz;
+
+                // value of a pure symbol as the value type of the expression
+                template<Invariant T, Invariant ST>
+                inline Result<T> symbol_value(ArgCLRefType<ST> value) noexcept
+                {
+                    if constexpr (DecaySameAs<ST, T>)
+                    {
+                        return value;
+                    }
+                    else if constexpr (std::convertible_to<ST, T>)
+                    {
+                        return static_cast<T>(value);
+                    }
+                    else
+                    {
+                        return OSPFError{ OSPFErrCode::ApplicationFail, std::format("lost transfer for {} to {}", TypeInfo<ST>::name(), TypeInfo<T>::name()) };
+                    }
+                }
+
+                // value of a pure symbol passed through the transfer if there is one
+                template<Invariant T, Invariant ST, typename TransferType>
+                inline Result<T> symbol_value(const std::optional<TransferType>& transfer, ArgCLRefType<ST> value) noexcept
+                {
+                    if (transfer.has_value())
+                    {
+                        return (*transfer)(value);
+                    }
+                    else
+                    {
+                        return symbol_value<T, ST>(value);
+                    }
+                }
+            };
+
             template<Invariant T, Invariant ST, ExpressionCategory cat, typename Self>
             class Expression
             {
@@ -72,6 +123,81 @@ namespace ospf
                         });
                 }
 
+                // values indexed by the symbol registry, see SymbolRegistry
+                inline constexpr Result<ValueType> value(const std::span<const SymbolValueType> values) const noexcept
+                {
+                    return Trait::get_value_by_index(self(), values);
+                }
+
+                // values at a batch of points stored column-major with one column per symbol,
+                // the value of the symbol of index i at point j is points[i * amount + j],
+                // only the symbols read by the expression are gathered into the point if it can collect them
+                inline Result<std::vector<ValueType>> values(const std::span<const SymbolValueType> points, const usize amount) const noexcept
+                {
+                    if (amount == 0_uz)
+                    {
+                        return std::vector<ValueType>{};
+                    }
+                    if (points.size() % amount != 0_uz)
+                    {
+                        return OSPFError{ OSPFErrCode::ApplicationFail, std::format("{} values cannot be split into {} points", points.size(), amount) };
+                    }
+
+                    const auto dimension = points.size() / amount;
+                    std::vector<u64> indices;
+                    bool collected{ false };
+                    if constexpr (requires (const Self& expression, std::vector<u64>& symbol_indices) { expression.collect_indices(symbol_indices); })
+                    {
+                        collected = self().collect_indices(indices);
+                    }
+                    if (collected)
+                    {
+                        // an index out of the points is left to the evaluation, which fails with it
+                        std::sort(indices.begin(), indices.end());
+                        indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+                        indices.erase(std::lower_bound(indices.begin(), indices.end(), static_cast<u64>(dimension)), indices.end());
+                    }
+                    else
+                    {
+                        indices.resize(dimension);
+                        std::iota(indices.begin(), indices.end(), 0_u64);
+                    }
+
+                    std::vector<ValueType> ret(amount);
+                    const auto evaluate_block = [this, points, amount, dimension, &indices, &ret](const usize block) -> Try<>
+                    {
+                        const auto bg = block * symbol_detail::batch_block_size;
+                        const auto ed = (std::min)(bg + symbol_detail::batch_block_size, amount);
+                        std::vector<SymbolValueType> point(dimension);
+                        for (usize j{ bg }; j != ed; ++j)
+                        {
+                            for (const auto i : indices)
+                            {
+                                point[i] = points[i * amount + j];
+                            }
+                            OSPF_TRY_GET(this_value, this->value(std::span<const SymbolValueType>{ point }));
+                            ret[j] = std::move(this_value);
+                        }
+                        return succeed;
+                    };
+
+                    const auto block_amount = (amount + symbol_detail::batch_block_size - 1_uz) / symbol_detail::batch_block_size;
+#ifdef OSPF_MULTI_THREAD
+                    if (amount >= symbol_detail::parallel_batch_threshold)
+                    {
+                        OSPF_TRY_EXEC(ThreadPool::instance().parallel_for(0_uz, block_amount, evaluate_block, 1_uz));
+                    }
+                    else
+#endif
+                    {
+                        for (usize block{ 0_uz }; block != block_amount; ++block)
+                        {
+                            OSPF_TRY_EXEC(evaluate_block(block));
+                        }
+                    }
+                    return std::move(ret);
+                }
+
                 template<typename F>
                     requires DecaySameAsOrConvertibleTo<std::invoke_result_t<F, std::string_view>, SymbolValueType>
                 inline constexpr Result<ValueType> value(const F& values) const noexcept
@@ -98,6 +224,12 @@ namespace ospf
                         static const auto get_impl = &Self::OSPF_CRTP_FUNCTION(get_value_by);
                         return (self.*get_impl)(values);
                     }
+
+                    inline static constexpr Result<ValueType> get_value_by_index(const Self& self, const std::span<const SymbolValueType> values) noexcept
+                    {
+                        static const auto get_impl = &Self::OSPF_CRTP_FUNCTION(get_value_by_index);
+                        return (self.*get_impl)(values);
+                    }
                 };
             };
 
@@ -78,6 +78,15 @@ namespace ospf
                     return comparison_operator_of<ValueType>(_sign);
                 }
 
+            public:
+                // adds the registry indices of the pure symbols read by both sides, returns false if some of them are unknown
+                template<typename = void>
+                    requires requires (const LhsType& lhs, const RhsType& rhs, std::vector<u64>& indices) { lhs.collect_indices(indices); rhs.collect_indices(indices); }
+                inline const bool collect_indices(std::vector<u64>& indices) const noexcept
+                {
+                    return _lhs.collect_indices(indices) && _rhs.collect_indices(indices);
+                }
+
             OSPF_CRTP_PERMISSION:
                 inline constexpr Result<bool> OSPF_CRTP_FUNCTION(get_value_by)(const std::function<Result<SymbolValueType>(const std::string_view)>& values) const noexcept
                 {
@@ -88,6 +97,15 @@ namespace ospf
                     return op(lhs_value, rhs_value);
                 }
 
+                inline constexpr Result<bool> OSPF_CRTP_FUNCTION(get_value_by_index)(const std::span<const SymbolValueType> values) const noexcept
+                {
+                    OSPF_TRY_GET(lhs_value, _lhs.value(values));
+                    OSPF_TRY_GET(rhs_value, _rhs.value(values));
+
+                    const auto op = comparison_operator();
+                    return op(lhs_value, rhs_value);
+                }
+
             private:
                 LhsType _lhs;
                 RhsType _rhs;
@@ -124,6 +124,20 @@ namespace ospf
                     return *this;
                 }
 
+                template<typename Compiler>
+                    requires requires (const CellType& cell, Compiler& compiler, const ValueType& coefficient) { cell.compile_to(compiler, coefficient); }
+                inline Try<> compile_to(Compiler& compiler, ArgCLRefType<ValueType> coefficient) const noexcept
+                {
+                    return _cell.compile_to(compiler, coefficient * _coefficient);
+                }
+
+                template<typename = void>
+                    requires requires (const CellType& cell, std::vector<u64>& indices) { cell.collect_indices(indices); }
+                inline const bool collect_indices(std::vector<u64>& indices) const noexcept
+                {
+                    return _cell.collect_indices(indices);
+                }
+
             OSPF_CRTP_PERMISSION:
                 inline constexpr RetType<ValueType> OSPF_CRTP_FUNCTION(get_value_by)(const std::function<Result<SymbolValueType>(const std::string_view)>& values) const noexcept
                 {
@@ -131,6 +145,12 @@ namespace ospf
                     return _coefficient * symbol_value;
                 }
 
+                inline constexpr RetType<ValueType> OSPF_CRTP_FUNCTION(get_value_by_index)(const std::span<const SymbolValueType> values) const noexcept
+                {
+                    OSPF_TRY_GET(symbol_value, _cell.value(values));
+                    return _coefficient * symbol_value;
+                }
+
             private:
                 ValueType _coefficient;
                 CellType _cell;
@@ -83,30 +83,80 @@ namespace ospf
                         {
                             using ThisType = OriginType<decltype(sym)>;
                             if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>)
+                            {
+                                OSPF_TRY_GET(value, values(sym->name()));
+                                return symbol_detail::symbol_value<ValueType, SymbolValueType>(_transfer, value);
+                            }
+                            else
+                            {
+                                return sym->value(values);
+                            }
+                        }, _symbol);
+                }
+
+                inline constexpr RetType<ValueType> OSPF_CRTP_FUNCTION(get_value_by_index)(const std::span<const SymbolValueType> values) const noexcept
+                {
+                    return std::visit([this, values](const auto sym) -> Result<ValueType>
+                        {
+                            using ThisType = OriginType<decltype(sym)>;
+                            if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>>)
+                            {
+                                OSPF_TRY_GET(value, value_of(*sym, values));
+                                return symbol_detail::symbol_value<ValueType, SymbolValueType>(_transfer, value);
+                            }
+                            else
+                            {
+                                return sym->value(values);
+                            }
+                        }, _symbol);
+                }
+
+            public:
+                inline Try<> compile_to(LinearPolynomialCompiler<ValueType>& compiler, ArgCLRefType<ValueType> coefficient) const noexcept
+                {
+                    return std::visit([this, &compiler, &coefficient](const auto sym) -> Try<>
+                        {
+                            using ThisType = OriginType<decltype(sym)>;
+                            if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>>)
                             {
                                 if (_transfer.has_value())
                                 {
-                                    return (*_transfer)(values(sym->name()));
+                                    return OSPFError{ OSPFErrCode::ApplicationFail, std::format("symbol \"{}\" with a transfer cannot be compiled to a linear polynomial", sym->name()) };
                                 }
-                                else
+                                const auto index = sym->index();
+                                if (!index.has_value())
                                 {
-                                    if constexpr (DecaySameAs<SymbolValueType, ValueType>)
-                                    {
-                                        return values(sym->name());
-                                    }
-                                    else if (std::convertible_to<SymbolValueType, ValueType>)
-                                    {
-                                        return static_cast<ValueType>(values(sym->name()));
-                                    }
-                                    else
-                                    {
-                                        return OSPFError{ OSPFErrCode::ApplicationFail, std::format("lost transfer for {} to {}", TypeInfo<SymbolValueType>::name(), TypeInfo<ValueType>::name()) };
-                                    }
+                                    return OSPFError{ OSPFErrCode::ApplicationFail, std::format("symbol \"{}\" is not registered", sym->name()) };
                                 }
+                                compiler.add(*index, coefficient);
+                                return succeed;
                             }
                             else
                             {
-                                return sym->value(values);
+                                return sym->compile_to(compiler, coefficient);
+                            }
+                        }, _symbol);
+                }
+
+                // adds the registry indices of the pure symbols read by the cell, returns false if some of them are unknown
+                inline const bool collect_indices(std::vector<u64>& indices) const noexcept
+                {
+                    return std::visit([&indices](const auto sym) -> bool
+                        {
+                            using ThisType = OriginType<decltype(sym)>;
+                            if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>>)
+                            {
+                                const auto index = sym->index();
+                                if (!index.has_value())
+                                {
+                                    return false;
+                                }
+                                indices.push_back(*index);
+                                return true;
+                            }
+                            else
+                            {
+                                return sym->collect_indices(indices);
                             }
                         }, _symbol);
                 }
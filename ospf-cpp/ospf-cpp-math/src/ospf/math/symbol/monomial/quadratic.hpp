@@ -282,25 +282,8 @@ namespace ospf
                         using ThisType = OriginType<decltype(sym)>;
                         if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>>)
                         {
-                            if (_transfer.has_value())
-                            {
-                                return (*_transfer)(values(sym->name()));
-                            }
-                            else
-                            {
-                                if constexpr (DecaySameAs<SymbolValueType, ValueType>)
-                                {
-                                    return values(sym->name());
-                                }
-                                else if (std::convertible_to<SymbolValueType, ValueType>)
-                                {
-                                    return static_cast<SymbolValueType>(values(sym->name()));
-                                }
-                                else
-                                {
-                                    return OSPFError{ OSPFErrCode::ApplicationFail, std::format("lost transfer for {} to {}", TypeInfo<SymbolValueType>::name(), TypeInfo<ValueType>::name()) };
-                                }
-                            }
+                            OSPF_TRY_GET(value, values(sym->name()));
+                            return symbol_detail::symbol_value<ValueType, SymbolValueType>(_transfer, value);
                         }
                         else
                         {
@@ -314,25 +297,8 @@ namespace ospf
                                 using ThisType = OriginType<decltype(sym)>;
                                 if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>>)
                                 {
-                                    if (_transfer.has_value())
-                                    {
-                                        return (*_transfer)(values(sym->name()));
-                                    }
-                                    else
-                                    {
-                                        if constexpr (DecaySameAs<SymbolValueType, ValueType>)
-                                        {
-                                            return values(sym->name());
-                                        }
-                                        else if (std::convertible_to<SymbolValueType, ValueType>)
-                                        {
-                                            return static_cast<ValueType>(values(sym->name()));
-                                        }
-                                        else
-                                        {
-                                            return OSPFError{ OSPFErrCode::ApplicationFail, std::format("lost transfer for {} to {}", TypeInfo<SymbolValueType>::name(), TypeInfo<ValueType>::name()) };
-                                        }
-                                    }
+                                    OSPF_TRY_GET(value, values(sym->name()));
+                                    return symbol_detail::symbol_value<ValueType, SymbolValueType>(_transfer, value);
                                 }
                                 else
                                 {
@@ -347,6 +313,124 @@ namespace ospf
                     }
                 }
 
+                inline constexpr RetType<ValueType> OSPF_CRTP_FUNCTION(get_value_by_index)(const std::span<const SymbolValueType> values) const noexcept
+                {
+                    OSPF_TRY_GET(value1, value_by_index(_symbol1, values));
+                    if (_symbol2.has_value())
+                    {
+                        OSPF_TRY_GET(value2, value_by_index(*_symbol2, values));
+                        return value1 * value2;
+                    }
+                    else
+                    {
+                        return value1;
+                    }
+                }
+
+            public:
+                inline Try<> compile_to(QuadraticPolynomialCompiler<ValueType>& compiler, ArgCLRefType<ValueType> coefficient) const noexcept
+                {
+                    if (_transfer.has_value())
+                    {
+                        return OSPFError{ OSPFErrCode::ApplicationFail, "quadratic monomial cell with a transfer cannot be compiled to a quadratic polynomial" };
+                    }
+                    if (_symbol2.has_value())
+                    {
+                        OSPF_TRY_GET(lhs, linear_form_of(_symbol1));
+                        OSPF_TRY_GET(rhs, linear_form_of(*_symbol2));
+                        compiler.add(lhs, rhs, coefficient);
+                        return succeed;
+                    }
+                    return std::visit([&compiler, &coefficient](const auto sym) -> Try<>
+                        {
+                            using ThisType = OriginType<decltype(sym)>;
+                            if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>>)
+                            {
+                                const auto index = sym->index();
+                                if (!index.has_value())
+                                {
+                                    return OSPFError{ OSPFErrCode::ApplicationFail, std::format("symbol \"{}\" is not registered", sym->name()) };
+                                }
+                                compiler.add(*index, coefficient);
+                                return succeed;
+                            }
+                            else
+                            {
+                                return sym->compile_to(compiler, coefficient);
+                            }
+                        }, _symbol1);
+                }
+
+                // adds the registry indices of the pure symbols read by the cell, returns false if some of them are unknown
+                inline const bool collect_indices(std::vector<u64>& indices) const noexcept
+                {
+                    return collect_indices_of(_symbol1, indices) && (!_symbol2.has_value() || collect_indices_of(*_symbol2, indices));
+                }
+
+            private:
+                inline static const bool collect_indices_of(const Variant& symbol, std::vector<u64>& indices) noexcept
+                {
+                    return std::visit([&indices](const auto sym) -> bool
+                        {
+                            using ThisType = OriginType<decltype(sym)>;
+                            if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>>)
+                            {
+                                const auto index = sym->index();
+                                if (!index.has_value())
+                                {
+                                    return false;
+                                }
+                                indices.push_back(*index);
+                                return true;
+                            }
+                            else
+                            {
+                                return sym->collect_indices(indices);
+                            }
+                        }, symbol);
+                }
+
+                // a factor of a product, an expression symbol in it must be linear
+                inline static Result<CompiledLinearPolynomial<ValueType>> linear_form_of(const Variant& symbol) noexcept
+                {
+                    return std::visit([](const auto sym) -> Result<CompiledLinearPolynomial<ValueType>>
+                        {
+                            using ThisType = OriginType<decltype(sym)>;
+                            LinearPolynomialCompiler<ValueType> compiler;
+                            if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>>)
+                            {
+                                const auto index = sym->index();
+                                if (!index.has_value())
+                                {
+                                    return OSPFError{ OSPFErrCode::ApplicationFail, std::format("symbol \"{}\" is not registered", sym->name()) };
+                                }
+                                compiler.add(*index, ArithmeticTrait<ValueType>::one());
+                            }
+                            else
+                            {
+                                OSPF_TRY_EXEC(sym->compile_to(compiler, ArithmeticTrait<ValueType>::one()));
+                            }
+                            return std::move(compiler).compile();
+                        }, symbol);
+                }
+
+                inline constexpr Result<ValueType> value_by_index(const Variant& symbol, const std::span<const SymbolValueType> values) const noexcept
+                {
+                    return std::visit([this, values](const auto sym) -> Result<ValueType>
+                        {
+                            using ThisType = OriginType<decltype(sym)>;
+                            if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>>)
+                            {
+                                OSPF_TRY_GET(value, value_of(*sym, values));
+                                return symbol_detail::symbol_value<ValueType, SymbolValueType>(_transfer, value);
+                            }
+                            else
+                            {
+                                return sym->value(values);
+                            }
+                        }, symbol);
+                }
+
             private:
                 Variant _symbol1;
                 std::optional<Variant> _symbol2;
@@ -242,6 +242,38 @@ namespace ospf
                     return *this;
                 }
 
+            public:
+                // adds the registry indices of the pure symbols read by the cell, returns false if some of them are unknown
+                inline const bool collect_indices(std::vector<u64>& indices) const noexcept
+                {
+                    for (const auto& [symbol, exponent] : _symbols)
+                    {
+                        const auto known = std::visit([&indices](const auto sym) -> bool
+                            {
+                                using ThisType = OriginType<decltype(sym)>;
+                                if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>>)
+                                {
+                                    const auto index = sym->index();
+                                    if (!index.has_value())
+                                    {
+                                        return false;
+                                    }
+                                    indices.push_back(*index);
+                                    return true;
+                                }
+                                else
+                                {
+                                    return sym->collect_indices(indices);
+                                }
+                            }, symbol);
+                        if (!known)
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
             private:
                 inline static constexpr const bool same_as(const Variant& lhs, const PureSymbolType& sym) noexcept
                 {
@@ -276,28 +308,41 @@ namespace ospf
                 }
 
             OSPF_CRTP_PERMISSION:
-                inline constexpr RetType<ValueType> get_value_by(const std::function<Result<ValueType>(const std::string_view)>& values) const noexcept
+                inline constexpr RetType<ValueType> OSPF_CRTP_FUNCTION(get_value_by)(const std::function<Result<SymbolValueType>(const std::string_view)>& values) const noexcept
                 {
-                    auto ret = ArithmeticTrait<ValueType>::zero();
-                    for (const auto [symbol, index] : _symbols)
+                    auto ret = ArithmeticTrait<ValueType>::one();
+                    for (const auto& [symbol, index] : _symbols)
                     {
                         OSPF_TRY_GET(value, std::visit([this, &values](const auto sym) -> Result<ValueType>
                             {
                                 using ThisType = OriginType<decltype(sym)>;
                                 if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>>)
                                 {
-                                    if constexpr (DecaySameAs<SymbolValueType, ValueType>)
-                                    {
-                                        return values(sym->name());
-                                    }
-                                    else if (std::convertible_to<SymbolValueType, ValueType>)
-                                    {
-                                        return static_cast<ValueType>(values(sym->name()));
-                                    }
-                                    else
-                                    {
-                                        return OSPFError{ OSPFErrCode::ApplicationFail, std::format("lost transfer for {} to {}", TypeInfo<SymbolValueType>::name(), TypeInfo<ValueType>::name()) };
-                                    }
+                                    OSPF_TRY_GET(value, values(sym->name()));
+                                    return symbol_detail::symbol_value<ValueType, SymbolValueType>(_transfer, value);
+                                }
+                                else
+                                {
+                                    return sym->value(values);
+                                }
+                            }, symbol));
+                        ret *= pow(value, static_cast<i64>(index));
+                    }
+                    return ret;
+                }
+
+                inline constexpr RetType<ValueType> OSPF_CRTP_FUNCTION(get_value_by_index)(const std::span<const SymbolValueType> values) const noexcept
+                {
+                    auto ret = ArithmeticTrait<ValueType>::one();
+                    for (const auto& [symbol, index] : _symbols)
+                    {
+                        OSPF_TRY_GET(value, std::visit([this, values](const auto sym) -> Result<ValueType>
+                            {
+                                using ThisType = OriginType<decltype(sym)>;
+                                if constexpr (DecaySameAs<ThisType, Ref<PureSymbolType>>)
+                                {
+                                    OSPF_TRY_GET(value, value_of(*sym, values));
+                                    return symbol_detail::symbol_value<ValueType, SymbolValueType>(_transfer, value);
                                 }
                                 else
                                 {
@@ -315,7 +360,7 @@ namespace ospf
             };
 
             template<Invariant T = f64, Invariant ST = f64, PureSymbolType PSym = PureSymbol, typename ESym = IExprSymbol<T, ST, ExpressionCategory::Standard>>
-            using StandardMonomial = Monomial<T, ST, ExpressionCategory::Standard, StandardMonomialCell<T, PSym, ESym>>;
+            using StandardMonomial = Monomial<T, ST, ExpressionCategory::Standard, StandardMonomialCell<T, ST, PSym, ESym>>;
 
             namespace standard
             {
@@ -177,6 +177,56 @@ namespace ospf
                     return *this;
                 }
 
+            public:
+                // flat form with the terms of the same symbol merged and the expression symbols inlined,
+                // every pure symbol in it must be registered
+                template<typename = void>
+                    requires (cat == ExpressionCategory::Linear)
+                        && requires (const MonomialType& mono, LinearPolynomialCompiler<ValueType>& compiler, const ValueType& coefficient) { mono.compile_to(compiler, coefficient); }
+                inline Result<CompiledLinearPolynomial<ValueType>> compile(void) const noexcept
+                {
+                    LinearPolynomialCompiler<ValueType> compiler;
+                    OSPF_TRY_EXEC(compile_to(compiler, ArithmeticTrait<ValueType>::one()));
+                    return std::move(compiler).compile();
+                }
+
+                template<typename = void>
+                    requires (cat == ExpressionCategory::Quadratic)
+                        && requires (const MonomialType& mono, QuadraticPolynomialCompiler<ValueType>& compiler, const ValueType& coefficient) { mono.compile_to(compiler, coefficient); }
+                inline Result<CompiledQuadraticPolynomial<ValueType>> compile(void) const noexcept
+                {
+                    QuadraticPolynomialCompiler<ValueType> compiler;
+                    OSPF_TRY_EXEC(compile_to(compiler, ArithmeticTrait<ValueType>::one()));
+                    return std::move(compiler).compile();
+                }
+
+                template<typename Compiler>
+                    requires requires (const MonomialType& mono, Compiler& compiler, const ValueType& coefficient) { mono.compile_to(compiler, coefficient); }
+                inline Try<> compile_to(Compiler& compiler, ArgCLRefType<ValueType> coefficient) const noexcept
+                {
+                    compiler.add_constant(coefficient * _constant);
+                    for (const auto& mono : _monos)
+                    {
+                        OSPF_TRY_EXEC(mono.compile_to(compiler, coefficient));
+                    }
+                    return succeed;
+                }
+
+                // adds the registry indices of the pure symbols read by the polynomial, returns false if some of them are unknown
+                template<typename = void>
+                    requires requires (const MonomialType& mono, std::vector<u64>& indices) { mono.collect_indices(indices); }
+                inline const bool collect_indices(std::vector<u64>& indices) const noexcept
+                {
+                    for (const auto& mono : _monos)
+                    {
+                        if (!mono.collect_indices(indices))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
             OSPF_CRTP_PERMISSION:
                 inline constexpr RetType<ValueType> OSPF_CRTP_FUNCTION(get_value_by)(const std::function<Result<SymbolValueType>(const std::string_view)>& values) const noexcept
                 {
@@ -189,6 +239,17 @@ namespace ospf
                     return ret;
                 }
 
+                inline constexpr RetType<ValueType> OSPF_CRTP_FUNCTION(get_value_by_index)(const std::span<const SymbolValueType> values) const noexcept
+                {
+                    auto ret = _constant;
+                    for (const auto& mono : _monos)
+                    {
+                        OSPF_TRY_GET(value, mono.value(values));
+                        ret += value;
+                    }
+                    return ret;
+                }
+
             private:
                 std::vector<MonomialType> _monos;
                 ValueType _constant;
@@ -1,4 +1,5 @@
 #pragma once
 
 #include <ospf/math/symbol/symbol/pure.hpp>
+#include <ospf/math/symbol/symbol/registry.hpp>
 #include <ospf/math/symbol/symbol/expression.hpp>
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <ospf/math/functional/predicate.hpp>
+#include <ospf/math/symbol/compiled/linear.hpp>
+#include <ospf/math/symbol/compiled/quadratic.hpp>
 #include <ospf/math/symbol/symbol/concepts.hpp>
 #include <ospf/math/symbol/expression.hpp>
 #include <ospf/meta_programming/type_info.hpp>
@@ -49,6 +51,26 @@ namespace ospf
 
             protected:
                 virtual RetType<ValueType> value_by(const std::function<Result<ValueType>(const std::string_view)>& values) const noexcept = 0;
+                // expression symbols are not registered, they are always evaluated by their expressions
+                virtual RetType<ValueType> value_by_index(const std::span<const SymbolValueType> values) const noexcept = 0;
+
+            public:
+                // adds the terms of the expression multiplied by the coefficient, fails if the expression is not linear
+                virtual Try<> compile_to(LinearPolynomialCompiler<ValueType>& compiler, ArgCLRefType<ValueType> coefficient) const noexcept
+                {
+                    return OSPFError{ OSPFErrCode::ApplicationFail, std::format("expression symbol \"{}\" cannot be compiled to a linear polynomial", this->name()) };
+                }
+
+                virtual Try<> compile_to(QuadraticPolynomialCompiler<ValueType>& compiler, ArgCLRefType<ValueType> coefficient) const noexcept
+                {
+                    return OSPFError{ OSPFErrCode::ApplicationFail, std::format("expression symbol \"{}\" cannot be compiled to a quadratic polynomial", this->name()) };
+                }
+
+                // adds the registry indices of the pure symbols read by the expression, returns false if some of them are unknown
+                virtual const bool collect_indices(std::vector<u64>& indices) const noexcept
+                {
+                    return false;
+                }
 
             OSPF_CRTP_PERMISSION:
                 inline constexpr const bool OSPF_CRTP_FUNCTION(is_pure)(void) const noexcept
@@ -61,25 +83,7 @@ namespace ospf
                     auto ret = values(this->name());
                     if (ret.is_succeeded())
                     {
-                        if (_transfer.has_value())
-                        {
-                            return (*_transfer)(std::move(ret).unwrap());
-                        }
-                        else
-                        {
-                            if constexpr (DecaySameAs<SymbolValueType, ValueType>)
-                            {
-                                return std::move(ret).unwrap();
-                            }
-                            else if (std::convertible_to<SymbolValueType, ValueType>)
-                            {
-                                return static_cast<ValueType>(std::move(ret).unwrap());
-                            }
-                            else
-                            {
-                                return OSPFError{ OSPFErrCode::ApplicationFail, std::format("lost transfer for {} to {}", TypeInfo<SymbolValueType>::name(), TypeInfo<ValueType>::name()) };
-                            }
-                        }
+                        return symbol_detail::symbol_value<ValueType, SymbolValueType>(_transfer, std::move(ret).unwrap());
                     }
                     else
                     {
@@ -87,6 +91,11 @@ namespace ospf
                     }
                 }
 
+                inline constexpr RetType<ValueType> OSPF_CRTP_FUNCTION(get_value_by_index)(const std::span<const SymbolValueType> values) const noexcept
+                {
+                    return value_by_index(values);
+                }
+
             private:
                 std::optional<TransferType> _transfer;
             };
@@ -128,11 +137,52 @@ namespace ospf
                 constexpr ~ExprSymbol(void) noexcept = default;
 
             public:
-                inline RetType<ValueType> value_of(const std::function<Result<ValueType>(const std::string_view)>& values) const noexcept override
+                inline RetType<ValueType> value_by(const std::function<Result<ValueType>(const std::string_view)>& values) const noexcept override
+                {
+                    return _expr.value(values);
+                }
+
+                inline RetType<ValueType> value_by_index(const std::span<const SymbolValueType> values) const noexcept override
                 {
                     return _expr.value(values);
                 }
 
+                inline Try<> compile_to(LinearPolynomialCompiler<ValueType>& compiler, ArgCLRefType<ValueType> coefficient) const noexcept override
+                {
+                    if constexpr (requires { _expr.compile_to(compiler, coefficient); })
+                    {
+                        return _expr.compile_to(compiler, coefficient);
+                    }
+                    else
+                    {
+                        return Interface::compile_to(compiler, coefficient);
+                    }
+                }
+
+                inline Try<> compile_to(QuadraticPolynomialCompiler<ValueType>& compiler, ArgCLRefType<ValueType> coefficient) const noexcept override
+                {
+                    if constexpr (requires { _expr.compile_to(compiler, coefficient); })
+                    {
+                        return _expr.compile_to(compiler, coefficient);
+                    }
+                    else
+                    {
+                        return Interface::compile_to(compiler, coefficient);
+                    }
+                }
+
+                inline const bool collect_indices(std::vector<u64>& indices) const noexcept override
+                {
+                    if constexpr (requires { _expr.collect_indices(indices); })
+                    {
+                        return _expr.collect_indices(indices);
+                    }
+                    else
+                    {
+                        return Interface::collect_indices(indices);
+                    }
+                }
+
             private:
                 ExpressionType _expr;
             };
@@ -8,10 +8,13 @@ namespace ospf
     {
         inline namespace symbol
         {
+            class SymbolRegistry;
+
             class PureSymbol
                 : public Symbol<PureSymbol>
             {
                 using Impl = Symbol<PureSymbol>;
+                friend class SymbolRegistry;
 
             public:
                 constexpr PureSymbol(std::string name)
@@ -27,11 +30,23 @@ namespace ospf
                 constexpr PureSymbol& operator=(PureSymbol&& rhs) noexcept = default;
                 constexpr ~PureSymbol(void) noexcept = default;
 
+            public:
+                // dense index assigned by the registry of the symbol, a copy of the symbol keeps it
+                inline constexpr const std::optional<u64> index(void) const noexcept
+                {
+                    return _index;
+                }
+
             OSPF_CRTP_PERMISSION:
                 inline constexpr const bool OSPF_CRTP_FUNCTION(is_pure)(void) const noexcept
                 {
                     return true;
                 }
+
+            private:
+                // id of the registry assigning the index, 0 if the symbol is not registered
+                u64 _registry{ 0_u64 };
+                std::optional<u64> _index;
             };
 
             template<typename T>
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <ospf/functional/result.hpp>
+#include <ospf/math/symbol/symbol/pure.hpp>
+#include <atomic>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace ospf
+{
+    inline namespace math
+    {
+        inline namespace symbol
+        {
+            // assigns dense indices from 0 to pure symbols,
+            // so that expressions are evaluated with a span of values indexed by them instead of looking up their names,
+            // the registry keeps the names of the symbols only, so the symbols may be moved or destroyed after being added
+            class SymbolRegistry
+            {
+            public:
+                SymbolRegistry(void)
+                    : _id(next_id()) {}
+
+                SymbolRegistry(const SymbolRegistry& ano) = delete;
+
+                // the symbols registered belong to the new registry, the moved one starts over with a new id
+                SymbolRegistry(SymbolRegistry&& ano) noexcept
+                    : _id(ano._id), _names(std::move(ano._names))
+                {
+                    ano._id = next_id();
+                    ano._names.clear();
+                }
+
+                SymbolRegistry& operator=(const SymbolRegistry& rhs) = delete;
+
+                SymbolRegistry& operator=(SymbolRegistry&& rhs) noexcept
+                {
+                    if (this != &rhs)
+                    {
+                        _id = rhs._id;
+                        _names = std::move(rhs._names);
+                        rhs._id = next_id();
+                        rhs._names.clear();
+                    }
+                    return *this;
+                }
+
+                ~SymbolRegistry(void) noexcept = default;
+
+            public:
+                inline const usize size(void) const noexcept
+                {
+                    return _names.size();
+                }
+
+                // name of the symbol of the index
+                inline const std::string_view operator[](const u64 index) const noexcept
+                {
+                    return _names[index];
+                }
+
+            public:
+                // index of the symbol, assigned if the symbol is not registered yet
+                inline Result<u64> add(PureSymbol& symbol) noexcept
+                {
+                    if (symbol._index.has_value())
+                    {
+                        if (symbol._registry == _id)
+                        {
+                            return *symbol._index;
+                        }
+                        return OSPFError{ OSPFErrCode::ApplicationFail, std::format("symbol \"{}\" is registered in another registry", symbol.name()) };
+                    }
+                    const auto index = static_cast<u64>(_names.size());
+                    symbol._registry = _id;
+                    symbol._index = index;
+                    _names.push_back(std::string{ symbol.name() });
+                    return index;
+                }
+
+                // values of the registered symbols in the order of their indices, got by their names
+                template<Invariant ST>
+                inline Result<std::vector<ST>> values(const std::function<Result<ST>(const std::string_view)>& values) const noexcept
+                {
+                    std::vector<ST> ret;
+                    ret.reserve(_names.size());
+                    for (const auto& name : _names)
+                    {
+                        OSPF_TRY_GET(value, values(name));
+                        ret.push_back(std::move(value));
+                    }
+                    return std::move(ret);
+                }
+
+            private:
+                // ids start from 1, 0 is kept for the symbols not registered
+                inline static const u64 next_id(void) noexcept
+                {
+                    static std::atomic<u64> id{ 1_u64 };
+                    return id.fetch_add(1_u64, std::memory_order_relaxed);
+                }
+
+            private:
+                u64 _id;
+                std::vector<std::string> _names;
+            };
+
+            // value of a pure symbol in a span of values indexed by a registry
+            template<Invariant ST>
+            inline Result<ST> value_of(const PureSymbol& symbol, const std::span<const ST> values) noexcept
+            {
+                const auto index = symbol.index();
+                if (!index.has_value())
+                {
+                    return OSPFError{ OSPFErrCode::ApplicationFail, std::format("symbol \"{}\" is not registered", symbol.name()) };
+                }
+                if (*index >= values.size())
+                {
+                    return OSPFError{ OSPFErrCode::ApplicationFail, std::format("value of symbol \"{}\" unmatched", symbol.name()) };
+                }
+                return values[*index];
+            }
+        };
+    };
+};
@@ -0,0 +1,155 @@
+#include <boost/test/unit_test.hpp>
+#include <ospf/math/symbol/compiled/incremental.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using namespace ospf;
+
+    static constexpr const usize dimension = 16_uz;
+
+    // integral coefficients and values, so that the deltas and the values are exact
+    inline std::vector<f64> random_point(std::mt19937_64& engine) noexcept
+    {
+        std::uniform_int_distribution<i64> distribution{ -4_i64, 4_i64 };
+        std::vector<f64> ret(dimension);
+        for (auto& value : ret)
+        {
+            value = static_cast<f64>(distribution(engine));
+        }
+        return ret;
+    }
+
+    template<typename P>
+    inline f64 full_value(const P& polynomial, const std::vector<f64>& point) noexcept
+    {
+        return polynomial.value(std::span<const f64>{ point }).unwrap();
+    }
+};
+
+BOOST_AUTO_TEST_CASE(linear_delta_test)
+{
+    using namespace ospf;
+
+    std::mt19937_64 engine{ 7_u64 };
+    std::uniform_int_distribution<u64> index_distribution{ 0_u64, dimension - 1_uz };
+    std::uniform_int_distribution<i64> coefficient_distribution{ -5_i64, 5_i64 };
+
+    LinearPolynomialCompiler<f64> compiler{};
+    for (usize k{ 0_uz }; k != 24_uz; ++k)
+    {
+        compiler.add(index_distribution(engine), static_cast<f64>(coefficient_distribution(engine)));
+    }
+    compiler.add_constant(3.0);
+    const auto polynomial = std::move(compiler).compile();
+
+    auto point = random_point(engine);
+    auto evaluator = IncrementalLinearEvaluator<f64>::make(polynomial, point).unwrap();
+    for (usize move{ 0_uz }; move != 1000_uz; ++move)
+    {
+        const auto index1 = index_distribution(engine);
+        const auto value1 = static_cast<f64>(coefficient_distribution(engine));
+        const auto before = full_value(polynomial, point);
+        if (move % 2_uz == 0_uz)
+        {
+            point[index1] = value1;
+            BOOST_ASSERT(evaluator.delta(index1, value1) == full_value(polynomial, point) - before);
+            evaluator.apply(index1, value1);
+        }
+        else
+        {
+            auto index2 = index_distribution(engine);
+            if (index2 == index1)
+            {
+                index2 = (index1 + 1_u64) % dimension;
+            }
+            const auto value2 = static_cast<f64>(coefficient_distribution(engine));
+            point[index1] = value1;
+            point[index2] = value2;
+            BOOST_ASSERT(evaluator.delta(index1, value1, index2, value2) == full_value(polynomial, point) - before);
+            evaluator.apply(index1, value1, index2, value2);
+        }
+        BOOST_ASSERT(evaluator.value() == full_value(polynomial, point));
+    }
+    evaluator.recompute();
+    BOOST_ASSERT(evaluator.value() == full_value(polynomial, point));
+}
+
+BOOST_AUTO_TEST_CASE(quadratic_delta_test)
+{
+    using namespace ospf;
+
+    std::mt19937_64 engine{ 11_u64 };
+    std::uniform_int_distribution<u64> index_distribution{ 0_u64, dimension - 1_uz };
+    std::uniform_int_distribution<i64> coefficient_distribution{ -5_i64, 5_i64 };
+
+    QuadraticPolynomialCompiler<f64> compiler{};
+    for (usize k{ 0_uz }; k != 48_uz; ++k)
+    {
+        compiler.add(index_distribution(engine), index_distribution(engine), static_cast<f64>(coefficient_distribution(engine)));
+    }
+    for (usize k{ 0_uz }; k != 12_uz; ++k)
+    {
+        compiler.add(index_distribution(engine), static_cast<f64>(coefficient_distribution(engine)));
+    }
+    compiler.add_constant(-2.0);
+    const auto polynomial = std::move(compiler).compile();
+
+    auto point = random_point(engine);
+    auto evaluator = IncrementalQuadraticEvaluator<f64>::make(polynomial, point).unwrap();
+    for (usize move{ 0_uz }; move != 1000_uz; ++move)
+    {
+        const auto index1 = index_distribution(engine);
+        const auto value1 = static_cast<f64>(coefficient_distribution(engine));
+        const auto before = full_value(polynomial, point);
+        if (move % 2_uz == 0_uz)
+        {
+            point[index1] = value1;
+            BOOST_ASSERT(evaluator.delta(index1, value1) == full_value(polynomial, point) - before);
+            evaluator.apply(index1, value1);
+        }
+        else
+        {
+            auto index2 = index_distribution(engine);
+            if (index2 == index1)
+            {
+                index2 = (index1 + 1_u64) % dimension;
+            }
+            const auto value2 = static_cast<f64>(coefficient_distribution(engine));
+            point[index1] = value1;
+            point[index2] = value2;
+            BOOST_ASSERT(evaluator.delta(index1, value1, index2, value2) == full_value(polynomial, point) - before);
+            evaluator.apply(index1, value1, index2, value2);
+        }
+        BOOST_ASSERT(evaluator.value() == full_value(polynomial, point));
+    }
+    evaluator.recompute();
+    BOOST_ASSERT(evaluator.value() == full_value(polynomial, point));
+}
+
+BOOST_AUTO_TEST_CASE(recompute_test)
+{
+    using namespace ospf;
+
+    // fractional moves accumulate rounding errors, which recompute drops
+    QuadraticPolynomialCompiler<f64> compiler{};
+    compiler.add(0_u64, 1_u64, 0.1);
+    compiler.add(1_u64, 1_u64, 0.3);
+    compiler.add(0_u64, 0.7);
+    const auto polynomial = std::move(compiler).compile();
+
+    std::vector<f64> point{ 0.0, 0.0 };
+    auto evaluator = IncrementalQuadraticEvaluator<f64>::make(polynomial, point).unwrap();
+    for (usize move{ 0_uz }; move != 10000_uz; ++move)
+    {
+        const auto index = static_cast<u64>(move % 2_uz);
+        point[index] = static_cast<f64>(move % 7_uz) * 0.1;
+        evaluator.apply(index, point[index]);
+    }
+    evaluator.recompute();
+    BOOST_ASSERT(evaluator.value() == full_value(polynomial, point));
+    const auto expected = full_value(polynomial, std::vector<f64>{ 1.0, point[1_uz] }) - full_value(polynomial, point);
+    BOOST_ASSERT(std::abs(evaluator.delta(0_u64, 1.0) - expected) < 1e-12);
+}
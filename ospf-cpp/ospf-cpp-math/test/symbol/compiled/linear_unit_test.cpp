@@ -0,0 +1,75 @@
+#define BOOST_TEST_MODULE ospf_math_unit_test
+#include <boost/test/included/unit_test.hpp>
+#include <ospf/math/symbol/compiled/linear.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(merge_test)
+{
+    using namespace ospf;
+
+    LinearPolynomialCompiler<f64> compiler{};
+    compiler.add(3_u64, 1.0);
+    compiler.add(1_u64, 2.0);
+    compiler.add(3_u64, 2.5);
+    compiler.add_constant(1.0);
+    compiler.add_constant(0.5);
+    const auto polynomial = std::move(compiler).compile();
+    BOOST_ASSERT(polynomial.size() == 2_uz);
+    BOOST_ASSERT((std::vector<u64>{ polynomial.indices().begin(), polynomial.indices().end() } == std::vector<u64>{ 1_u64, 3_u64 }));
+    BOOST_ASSERT((std::vector<f64>{ polynomial.coefficients().begin(), polynomial.coefficients().end() } == std::vector<f64>{ 2.0, 3.5 }));
+    BOOST_ASSERT(polynomial.constant() == 1.5);
+}
+
+BOOST_AUTO_TEST_CASE(cancel_test)
+{
+    using namespace ospf;
+
+    LinearPolynomialCompiler<f64> compiler{};
+    compiler.add(2_u64, 1.5);
+    compiler.add(0_u64, 1.0);
+    compiler.add(2_u64, -1.5);
+    compiler.add(5_u64, 4.0);
+    compiler.add(5_u64, -4.0);
+    const auto polynomial = std::move(compiler).compile();
+    BOOST_ASSERT(polynomial.size() == 1_uz);
+    BOOST_ASSERT(polynomial.indices()[0_uz] == 0_u64);
+    BOOST_ASSERT(polynomial.coefficients()[0_uz] == 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(value_test)
+{
+    using namespace ospf;
+
+    LinearPolynomialCompiler<f64> compiler{};
+    for (u64 i{ 0_u64 }; i != 9_u64; ++i)
+    {
+        compiler.add(i, static_cast<f64>(i + 1_u64));
+    }
+    compiler.add_constant(-3.0);
+    const auto polynomial = std::move(compiler).compile();
+
+    const std::vector<f64> values{ 1.0, -1.0, 2.0, 0.0, 3.0, 1.0, -2.0, 1.0, 2.0, 7.0 };
+    auto value = polynomial.value(std::span<const f64>{ values });
+    BOOST_ASSERT(!value.is_failed());
+    BOOST_ASSERT(std::move(value).unwrap() == 1.0 - 2.0 + 6.0 + 0.0 + 15.0 + 6.0 - 14.0 + 8.0 + 18.0 - 3.0);
+
+    const std::vector<f64> short_values{ 1.0, 2.0 };
+    BOOST_ASSERT(polynomial.value(std::span<const f64>{ short_values }).is_failed());
+}
+
+BOOST_AUTO_TEST_CASE(batch_value_test)
+{
+    using namespace ospf;
+
+    LinearPolynomialCompiler<f64> compiler{};
+    compiler.add(0_u64, 2.0);
+    compiler.add(2_u64, -1.0);
+    compiler.add_constant(1.0);
+    const auto polynomial = std::move(compiler).compile();
+
+    // three symbols at two points, one column per symbol
+    const std::vector<f64> points{ 1.0, 2.0, 5.0, 5.0, 3.0, 4.0 };
+    auto values = polynomial.values(std::span<const f64>{ points }, 2_uz);
+    BOOST_ASSERT(!values.is_failed());
+    BOOST_ASSERT((std::move(values).unwrap() == std::vector<f64>{ 2.0 * 1.0 - 3.0 + 1.0, 2.0 * 2.0 - 4.0 + 1.0 }));
+}
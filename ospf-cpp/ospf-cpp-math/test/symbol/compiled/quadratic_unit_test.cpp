@@ -0,0 +1,92 @@
+#include <boost/test/unit_test.hpp>
+#include <ospf/math/symbol/compiled/quadratic.hpp>
+#include <random>
+#include <tuple>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(doubled_diagonal_test)
+{
+    using namespace ospf;
+
+    QuadraticPolynomialCompiler<f64> compiler{};
+    compiler.add(1_u64, 1_u64, 3.0);
+    compiler.add(0_u64, 1_u64, 2.0);
+    compiler.add(1_u64, 0_u64, 1.0);
+    const auto polynomial = std::move(compiler).compile();
+    BOOST_ASSERT(polynomial.dimension() == 2_uz);
+    BOOST_ASSERT(polynomial.hessian(1_u64, 1_u64) == 6.0);
+    BOOST_ASSERT(polynomial.hessian(0_u64, 1_u64) == 3.0);
+    BOOST_ASSERT(polynomial.hessian(1_u64, 0_u64) == 3.0);
+    BOOST_ASSERT(polynomial.hessian(0_u64, 0_u64) == 0.0);
+
+    // 3 x1^2 + 3 x0 x1
+    const std::vector<f64> values{ 5.0, 2.0 };
+    auto value = polynomial.value(std::span<const f64>{ values });
+    BOOST_ASSERT(!value.is_failed());
+    BOOST_ASSERT(std::move(value).unwrap() == 3.0 * 4.0 + 3.0 * 10.0);
+}
+
+BOOST_AUTO_TEST_CASE(quadratic_cancel_test)
+{
+    using namespace ospf;
+
+    QuadraticPolynomialCompiler<f64> compiler{};
+    compiler.add(0_u64, 2_u64, 2.0);
+    compiler.add(2_u64, 0_u64, -2.0);
+    compiler.add(1_u64, 1.0);
+    const auto polynomial = std::move(compiler).compile();
+    BOOST_ASSERT(polynomial.columns().empty());
+    BOOST_ASSERT(polynomial.dimension() == 2_uz);
+    BOOST_ASSERT(polynomial.linear().size() == 1_uz);
+}
+
+BOOST_AUTO_TEST_CASE(sorted_rows_test)
+{
+    using namespace ospf;
+
+    static constexpr const usize dimension = 24_uz;
+    std::mt19937_64 engine{ 42_u64 };
+    std::uniform_int_distribution<u64> index_distribution{ 0_u64, dimension - 1_uz };
+    std::uniform_int_distribution<i64> coefficient_distribution{ -5_i64, 5_i64 };
+
+    // integral coefficients and values, so that every sum is exact
+    std::vector<std::tuple<u64, u64, f64>> terms;
+    QuadraticPolynomialCompiler<f64> compiler{};
+    for (usize k{ 0_uz }; k != 200_uz; ++k)
+    {
+        const auto i = index_distribution(engine);
+        const auto j = index_distribution(engine);
+        const auto coefficient = static_cast<f64>(coefficient_distribution(engine));
+        terms.push_back(std::make_tuple(i, j, coefficient));
+        compiler.add(i, j, coefficient);
+    }
+    const auto polynomial = std::move(compiler).compile();
+
+    const auto offsets = polynomial.offsets();
+    const auto columns = polynomial.columns();
+    for (usize i{ 0_uz }; i != polynomial.dimension(); ++i)
+    {
+        for (usize k{ offsets[i] }; k + 1_uz < offsets[i + 1_uz]; ++k)
+        {
+            BOOST_ASSERT(columns[k] < columns[k + 1_uz]);
+        }
+        for (usize k{ offsets[i] }; k != offsets[i + 1_uz]; ++k)
+        {
+            BOOST_ASSERT(polynomial.hessian(i, columns[k]) == polynomial.hessian(columns[k], i));
+        }
+    }
+
+    std::vector<f64> values(dimension);
+    for (auto& value : values)
+    {
+        value = static_cast<f64>(coefficient_distribution(engine));
+    }
+    auto expected = 0.0;
+    for (const auto& [i, j, coefficient] : terms)
+    {
+        expected += coefficient * values[i] * values[j];
+    }
+    auto value = polynomial.value(std::span<const f64>{ values });
+    BOOST_ASSERT(!value.is_failed());
+    BOOST_ASSERT(std::move(value).unwrap() == expected);
+}
@@ -0,0 +1,54 @@
+#include <boost/test/unit_test.hpp>
+#include <ospf/math/symbol/monomial/standard.hpp>
+#include <ospf/math/symbol/symbol/registry.hpp>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(standard_value_test)
+{
+    using namespace ospf;
+
+    PureSymbol x{ "x" };
+    PureSymbol y{ "y" };
+    PureSymbol z{ "z" };
+    SymbolRegistry registry{};
+    BOOST_ASSERT(registry.add(z).is_succeeded());
+    BOOST_ASSERT(registry.add(x).is_succeeded());
+    BOOST_ASSERT(registry.add(y).is_succeeded());
+
+    // 2 * x * y^2
+    StandardMonomialCell<f64, f64> cell{ x };
+    cell *= y;
+    cell *= y;
+    const StandardMonomial<f64, f64> monomial{ 2.0, std::move(cell) };
+
+    const std::function<Result<f64>(const std::string_view)> lookup = [](const std::string_view name) -> Result<f64>
+    {
+        if (name == "x")
+        {
+            return 3.0;
+        }
+        else if (name == "y")
+        {
+            return -2.0;
+        }
+        else if (name == "z")
+        {
+            return 5.0;
+        }
+        return OSPFError{ OSPFErrCode::ApplicationFail, "unknown symbol" };
+    };
+    auto by_name = monomial.value(lookup);
+    BOOST_ASSERT(by_name.is_succeeded());
+
+    auto point = registry.values(lookup);
+    BOOST_ASSERT(point.is_succeeded());
+    const std::vector<f64> values = std::move(point).unwrap();
+    auto by_index = monomial.value(std::span<const f64>{ values });
+    BOOST_ASSERT(by_index.is_succeeded());
+
+    const auto expected = 2.0 * 3.0 * (-2.0) * (-2.0);
+    BOOST_ASSERT(std::move(by_name).unwrap() == expected);
+    BOOST_ASSERT(std::move(by_index).unwrap() == expected);
+}
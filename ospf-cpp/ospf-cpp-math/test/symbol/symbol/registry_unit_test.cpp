@@ -0,0 +1,36 @@
+#include <boost/test/unit_test.hpp>
+#include <ospf/math/symbol/symbol/registry.hpp>
+#include <memory>
+#include <utility>
+
+BOOST_AUTO_TEST_CASE(registry_test)
+{
+    using namespace ospf;
+
+    SymbolRegistry registry{};
+    auto x = std::make_unique<PureSymbol>("x");
+    PureSymbol y{ "y" };
+    BOOST_ASSERT(registry.add(*x).unwrap() == 0_u64);
+    BOOST_ASSERT(registry.add(y).unwrap() == 1_u64);
+    BOOST_ASSERT(registry.add(y).unwrap() == 1_u64);
+
+    // a copy keeps the index, the registry does not refer to the symbols
+    const PureSymbol x_copy{ *x };
+    x.reset();
+    BOOST_ASSERT(registry.size() == 2_uz);
+    BOOST_ASSERT(registry[0_u64] == "x");
+    BOOST_ASSERT(x_copy.index() == 0_u64);
+
+    // a symbol of the same name is not the symbol of another registry
+    SymbolRegistry another{};
+    PureSymbol another_y{ "y" };
+    BOOST_ASSERT(another.add(another_y).unwrap() == 0_u64);
+    BOOST_ASSERT(registry.add(another_y).is_failed());
+    BOOST_ASSERT(another.add(y).is_failed());
+
+    // the symbols follow the registry moved
+    SymbolRegistry moved{ std::move(registry) };
+    BOOST_ASSERT(moved.add(y).unwrap() == 1_u64);
+    BOOST_ASSERT(registry.size() == 0_uz);
+    BOOST_ASSERT(registry.add(y).is_failed());
+}